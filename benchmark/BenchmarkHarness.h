@@ -0,0 +1,245 @@
+#ifndef MATIOCPP_BENCHMARKHARNESS_H
+#define MATIOCPP_BENCHMARKHARNESS_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <matio.h>
+
+namespace matioCppBenchmarks
+{
+
+/**
+ * @brief Prevent the compiler from optimizing away the computation of a value.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<const volatile char*>(&value);
+#endif
+}
+
+/**
+ * @brief The outcome of a single benchmark.
+ */
+struct Result
+{
+    std::string name;
+    size_t iterations{0}; /** Number of iterations of each repetition. **/
+    size_t repetitions{0};
+    double medianNanoseconds{0.0}; /** Median time of an iteration across the repetitions. **/
+    double minNanoseconds{0.0}; /** Minimum time of an iteration across the repetitions. **/
+    double bytesPerSecond{0.0}; /** Throughput computed from the median time. Zero if not meaningful. **/
+};
+
+/**
+ * @brief Minimal benchmark runner.
+ *
+ * Each benchmark body is run in batches of iterations. The batch size is increased until a batch takes
+ * at least the minimum time, then the batch is repeated to obtain the median and minimum time per iteration.
+ * The results are printed in a human readable form and saved in JSON.
+ *
+ * Command line options:
+ * - --filter <text>: run only the benchmarks whose name contains text.
+ * - --output <file>: write the JSON results to file instead of the standard output.
+ * - --min-time <seconds>: minimum duration of a batch (default 0.1).
+ * - --repetitions <n>: number of repeated batches (default 5).
+ */
+class Runner
+{
+    std::string m_filter;
+    std::string m_output;
+    double m_minTime{0.1};
+    size_t m_repetitions{5};
+    std::vector<Result> m_results;
+
+    static std::string escape(const std::string& input)
+    {
+        std::string output;
+        for (char c : input)
+        {
+            if (c == '"' || c == '\\')
+            {
+                output.push_back('\\');
+            }
+            output.push_back(c);
+        }
+        return output;
+    }
+
+    static double timeBatch(const std::function<void()>& body, size_t iterations)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            body();
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+public:
+
+    Runner(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string option = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (option == "--filter" && hasValue)
+            {
+                m_filter = argv[++i];
+            }
+            else if (option == "--output" && hasValue)
+            {
+                m_output = argv[++i];
+            }
+            else if (option == "--min-time" && hasValue)
+            {
+                m_minTime = std::atof(argv[++i]);
+            }
+            else if (option == "--repetitions" && hasValue)
+            {
+                m_repetitions = std::max(1, std::atoi(argv[++i]));
+            }
+            else
+            {
+                std::cerr << "[WARNING][matioCppBenchmarks::Runner] Ignoring the unknown option " << option << "." << std::endl;
+            }
+        }
+    }
+
+    /**
+     * @brief Check if a benchmark is selected by the filter
+     */
+    bool enabled(const std::string& name) const
+    {
+        return m_filter.empty() || name.find(m_filter) != std::string::npos;
+    }
+
+    /**
+     * @brief Run a benchmark
+     * @param name The name of the benchmark.
+     * @param bytesPerIteration The bytes processed by an iteration, used to compute the throughput. Zero to skip it.
+     * @param body The code to measure.
+     */
+    void run(const std::string& name, size_t bytesPerIteration, const std::function<void()>& body)
+    {
+        if (!enabled(name))
+        {
+            return;
+        }
+
+        body(); // Warm-up
+
+        size_t iterations = 1;
+        double elapsed = timeBatch(body, iterations);
+        while (elapsed < m_minTime * 1e9 && iterations < (size_t(1) << 30))
+        {
+            double target = m_minTime * 1e9 * 1.2;
+            size_t next = elapsed > 0 ? static_cast<size_t>(iterations * target / elapsed) : iterations * 10;
+            iterations = std::min(std::max(next, iterations * 2), iterations * 100);
+            elapsed = timeBatch(body, iterations);
+        }
+
+        std::vector<double> times(1, elapsed / iterations);
+        for (size_t r = 1; r < m_repetitions; ++r)
+        {
+            times.push_back(timeBatch(body, iterations) / iterations);
+        }
+        std::sort(times.begin(), times.end());
+
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.repetitions = times.size();
+        result.medianNanoseconds = times[times.size() / 2];
+        result.minNanoseconds = times.front();
+        if (bytesPerIteration > 0 && result.medianNanoseconds > 0)
+        {
+            result.bytesPerSecond = bytesPerIteration * 1e9 / result.medianNanoseconds;
+        }
+
+        std::cerr << name << ": " << result.medianNanoseconds << " ns";
+        if (result.bytesPerSecond > 0)
+        {
+            std::cerr << " (" << result.bytesPerSecond / (1024.0 * 1024.0) << " MiB/s)";
+        }
+        std::cerr << std::endl;
+
+        m_results.push_back(result);
+    }
+
+    /**
+     * @brief Write the results in JSON
+     */
+    void writeJson(std::ostream& output) const
+    {
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        output << "{\n  \"context\": {\n"
+               << "    \"date\": \"" << date << "\",\n"
+               << "    \"matio_version\": \"" << MATIO_MAJOR_VERSION << "." << MATIO_MINOR_VERSION << "." << MATIO_RELEASE_LEVEL << "\",\n"
+               << "    \"min_time_s\": " << m_minTime << ",\n"
+               << "    \"repetitions\": " << m_repetitions << "\n"
+               << "  },\n  \"benchmarks\": [";
+
+        for (size_t i = 0; i < m_results.size(); ++i)
+        {
+            const Result& result = m_results[i];
+            output << (i == 0 ? "\n" : ",\n")
+                   << "    {\"name\": \"" << escape(result.name) << "\""
+                   << ", \"iterations\": " << result.iterations
+                   << ", \"repetitions\": " << result.repetitions
+                   << ", \"median_ns\": " << result.medianNanoseconds
+                   << ", \"min_ns\": " << result.minNanoseconds
+                   << ", \"bytes_per_second\": " << result.bytesPerSecond << "}";
+        }
+        output << "\n  ]\n}\n";
+    }
+
+    /**
+     * @brief Save the results
+     * @return The exit code of the program.
+     */
+    int finish() const
+    {
+        if (m_output.empty())
+        {
+            writeJson(std::cout);
+            return EXIT_SUCCESS;
+        }
+
+        std::ofstream file(m_output);
+        if (!file.is_open())
+        {
+            std::cerr << "[ERROR][matioCppBenchmarks::Runner::finish] Failed to open " << m_output << "." << std::endl;
+            return EXIT_FAILURE;
+        }
+        writeJson(file);
+        return EXIT_SUCCESS;
+    }
+};
+
+}
+
+#endif // MATIOCPP_BENCHMARKHARNESS_H
@@ -0,0 +1,583 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/matioCpp.h>
+#include "BenchmarkHarness.h"
+
+using matioCppBenchmarks::Runner;
+using matioCppBenchmarks::doNotOptimize;
+
+namespace
+{
+
+const std::string benchmarkFile = "matioCppBenchmark.mat";
+
+std::vector<double> makeData(size_t size)
+{
+    std::vector<double> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<double>(i % 1000) * 0.25; // Some redundancy, to make compression meaningful
+    }
+    return data;
+}
+
+std::string versionName(matioCpp::FileVersion version)
+{
+    switch (version)
+    {
+    case matioCpp::FileVersion::MAT4:
+        return "MAT4";
+    case matioCpp::FileVersion::MAT5:
+        return "MAT5";
+    case matioCpp::FileVersion::MAT7_3:
+        return "MAT7_3";
+    default:
+        return "Default";
+    }
+}
+
+matioCpp::Struct makeNestedStruct(size_t depth, size_t vectorSize)
+{
+    std::vector<matioCpp::Variable> fields;
+    fields.emplace_back(matioCpp::Vector<double>("data", makeData(vectorSize)));
+    fields.emplace_back(matioCpp::Element<double>("scalar", 1.0));
+    if (depth > 0)
+    {
+        fields.emplace_back(makeNestedStruct(depth - 1, vectorSize));
+    }
+    return matioCpp::Struct(depth > 0 ? "level" + std::to_string(depth) : "leaf", fields);
+}
+
+void fileBenchmarks(Runner& runner)
+{
+    const std::vector<size_t> sizes({1000, 100000, 1000000});
+    const std::vector<matioCpp::FileVersion> versions({matioCpp::FileVersion::MAT4,
+                                                       matioCpp::FileVersion::MAT5,
+                                                       matioCpp::FileVersion::MAT7_3});
+
+    for (matioCpp::FileVersion version : versions)
+    {
+        for (matioCpp::Compression compression : {matioCpp::Compression::None, matioCpp::Compression::zlib})
+        {
+            if (version == matioCpp::FileVersion::MAT4 && compression == matioCpp::Compression::zlib)
+            {
+                continue; // Not supported by MAT4
+            }
+
+            std::string suffix = versionName(version) + (compression == matioCpp::Compression::zlib ? "/zlib/" : "/none/");
+
+            for (size_t size : sizes)
+            {
+                matioCpp::Vector<double> vector("vector", makeData(size));
+                size_t bytes = size * sizeof(double);
+
+                matioCpp::File::Delete(benchmarkFile);
+                matioCpp::File file = matioCpp::File::Create(benchmarkFile, version);
+                if (!file.isOpen() || !file.write(vector, compression))
+                {
+                    std::cerr << "[WARNING][matioCppBenchmarks] Skipping the " << versionName(version) << " benchmarks, since the file version is not supported." << std::endl;
+                    break;
+                }
+                file.close();
+
+                runner.run("File/write/" + suffix + std::to_string(size), bytes, [&]()
+                {
+                    matioCpp::File output = matioCpp::File::Create(benchmarkFile, version);
+                    doNotOptimize(output.write(vector, compression));
+                });
+
+                matioCpp::File input(benchmarkFile, matioCpp::FileMode::ReadOnly);
+                runner.run("File/read/" + suffix + std::to_string(size), bytes, [&]()
+                {
+                    matioCpp::Variable read = input.read("vector");
+                    doNotOptimize(read);
+                });
+            }
+        }
+    }
+
+    matioCpp::File::Delete(benchmarkFile);
+}
+
+void constructionBenchmarks(Runner& runner)
+{
+    for (size_t size : {100, 1000000})
+    {
+        std::vector<double> data = makeData(size);
+
+        runner.run("Construction/Vector/" + std::to_string(size), size * sizeof(double), [&]()
+        {
+            matioCpp::Vector<double> vector("vector", data);
+            doNotOptimize(vector);
+        });
+
+        runner.run("Construction/Vector/move/" + std::to_string(size), 0, [&]()
+        {
+            std::vector<double> copy(data);
+            matioCpp::Vector<double> vector("vector", std::move(copy));
+            doNotOptimize(vector);
+        });
+
+        runner.run("Construction/raw/Mat_VarCreate/" + std::to_string(size), size * sizeof(double), [&]()
+        {
+            size_t dims[2] = {size, 1};
+            matvar_t* raw = Mat_VarCreate("vector", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims, data.data(), 0);
+            doNotOptimize(raw);
+            Mat_VarFree(raw);
+        });
+    }
+
+    std::vector<double> samples = makeData(100000);
+    runner.run("Construction/Vector/push_back/100000", samples.size() * sizeof(double), [&]()
+    {
+        matioCpp::Vector<double> vector("vector");
+        for (double sample : samples)
+        {
+            vector.push_back(sample);
+        }
+        doNotOptimize(vector);
+    });
+
+    runner.run("Construction/Vector/append/1000x100", samples.size() * sizeof(double), [&]()
+    {
+        matioCpp::Vector<double> vector("vector");
+        for (size_t i = 0; i < samples.size(); i += 100)
+        {
+            vector.append(matioCpp::make_span(samples).subspan(i, 100));
+        }
+        doNotOptimize(vector);
+    });
+
+    std::vector<double> matrixData = makeData(10000);
+    runner.run("Construction/MultiDimensionalArray/100x100", matrixData.size() * sizeof(double), [&]()
+    {
+        matioCpp::MultiDimensionalArray<double> array("array", {100, 100}, matrixData.data());
+        doNotOptimize(array);
+    });
+
+    std::vector<matioCpp::Variable> fields;
+    for (size_t i = 0; i < 20; ++i)
+    {
+        fields.emplace_back(matioCpp::Vector<double>("field" + std::to_string(i), makeData(100)));
+    }
+
+    runner.run("Construction/Struct/20fields", 0, [&]()
+    {
+        matioCpp::Struct structure("struct", fields);
+        doNotOptimize(structure);
+    });
+
+    std::vector<double> fieldData = makeData(100);
+    runner.run("Construction/Struct/20fields/setField", 0, [&]()
+    {
+        matioCpp::Struct structure("struct");
+        for (size_t i = 0; i < 20; ++i)
+        {
+            structure.setField(matioCpp::Vector<double>("field" + std::to_string(i), matioCpp::make_span(fieldData)));
+        }
+        doNotOptimize(structure);
+    });
+
+    runner.run("Construction/Struct/20fields/setFields", 0, [&]()
+    {
+        std::vector<matioCpp::Variable> newFields;
+        newFields.reserve(20);
+        for (size_t i = 0; i < 20; ++i)
+        {
+            newFields.emplace_back(matioCpp::Vector<double>("field" + std::to_string(i), matioCpp::make_span(fieldData)));
+        }
+        matioCpp::Struct structure("struct");
+        structure.setFields(std::move(newFields));
+        doNotOptimize(structure);
+    });
+
+    std::vector<matioCpp::Variable> cellElements;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        cellElements.emplace_back(matioCpp::Element<double>("element", static_cast<double>(i)));
+    }
+
+    runner.run("Construction/CellArray/10x10", 0, [&]()
+    {
+        matioCpp::CellArray cell("cell", {10, 10}, cellElements);
+        doNotOptimize(cell);
+    });
+
+    std::vector<double> cellElementData = makeData(10000);
+    auto makeCellElements = [&cellElementData]()
+    {
+        std::vector<matioCpp::Variable> elements;
+        elements.reserve(100);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            elements.emplace_back(matioCpp::Vector<double>("element", matioCpp::make_span(cellElementData)));
+        }
+        return elements;
+    };
+
+    runner.run("Construction/CellArray/10x10/newElements/copy", 0, [&]()
+    {
+        std::vector<matioCpp::Variable> elements = makeCellElements();
+        matioCpp::CellArray cell("cell", {10, 10}, elements);
+        doNotOptimize(cell);
+    });
+
+    runner.run("Construction/CellArray/10x10/newElements/move", 0, [&]()
+    {
+        matioCpp::CellArray cell("cell", {10, 10}, makeCellElements());
+        doNotOptimize(cell);
+    });
+
+    std::vector<matioCpp::Struct> structElements(100, matioCpp::Struct("element", {matioCpp::Element<double>("x", 1.0),
+                                                                                      matioCpp::Element<double>("y", 2.0)}));
+    runner.run("Construction/StructArray/10x10", 0, [&]()
+    {
+        matioCpp::StructArray array("array", {10, 10}, structElements);
+        doNotOptimize(array);
+    });
+
+    auto makeStructElements = []()
+    {
+        std::vector<matioCpp::Struct> elements;
+        elements.reserve(100);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            elements.emplace_back("element", std::vector<matioCpp::Variable>({matioCpp::Vector<double>("x", std::vector<double>(100, 1.0)),
+                                                                             matioCpp::Vector<double>("y", std::vector<double>(100, 2.0))}));
+        }
+        return elements;
+    };
+
+    runner.run("Construction/StructArray/10x10/newElements/copy", 0, [&]()
+    {
+        std::vector<matioCpp::Struct> elements = makeStructElements();
+        matioCpp::StructArray array("array", {10, 10}, elements);
+        doNotOptimize(array);
+    });
+
+    runner.run("Construction/StructArray/10x10/newElements/move", 0, [&]()
+    {
+        matioCpp::StructArray array("array", {10, 10}, makeStructElements());
+        doNotOptimize(array);
+    });
+
+    runner.run("Construction/CellArray/push_back/1000", 0, [&]()
+    {
+        matioCpp::CellArray cell("cell");
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            cell.push_back(matioCpp::Element<double>("element", static_cast<double>(i)));
+        }
+        doNotOptimize(cell);
+    });
+
+    runner.run("Construction/StructArray/push_back/1000", 0, [&]()
+    {
+        matioCpp::StructArray array("array");
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            array.push_back(matioCpp::Struct("element", {matioCpp::Element<double>("x", static_cast<double>(i)),
+                                                          matioCpp::Element<double>("y", 2.0)}));
+        }
+        doNotOptimize(array);
+    });
+}
+
+void accessBenchmarks(Runner& runner)
+{
+    const size_t size = 1000;
+    matioCpp::Vector<double> vector("vector", makeData(size));
+    std::vector<double> data = makeData(size);
+
+    runner.run("Access/Vector/operator()", size * sizeof(double), [&]()
+    {
+        double sum = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            sum += vector(i);
+        }
+        doNotOptimize(sum);
+    });
+
+    matioCpp::Struct container("container", {matioCpp::Variable(vector)});
+    matioCpp::Vector<double> field = container("vector").asVector<double>();
+    runner.run("Access/Vector/field/operator()", size * sizeof(double), [&]()
+    {
+        double sum = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            sum += field(i);
+        }
+        doNotOptimize(sum);
+    });
+
+    runner.run("Access/raw/pointer", size * sizeof(double), [&]()
+    {
+        const double* raw = static_cast<const double*>(vector.toMatio()->data);
+        double sum = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            sum += raw[i];
+        }
+        doNotOptimize(sum);
+    });
+
+    matioCpp::MultiDimensionalArray<double> array("array", {10, 10, 10}, data.data());
+    runner.run("Access/MultiDimensionalArray/operator()", size * sizeof(double), [&]()
+    {
+        double sum = 0;
+        for (size_t k = 0; k < 10; ++k)
+        {
+            for (size_t j = 0; j < 10; ++j)
+            {
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    sum += array({i, j, k});
+                }
+            }
+        }
+        doNotOptimize(sum);
+    });
+
+    runner.run("Access/MultiDimensionalArray/operator()/variadic", size * sizeof(double), [&]()
+    {
+        double sum = 0;
+        for (size_t k = 0; k < 10; ++k)
+        {
+            for (size_t j = 0; j < 10; ++j)
+            {
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    sum += array(i, j, k);
+                }
+            }
+        }
+        doNotOptimize(sum);
+    });
+
+    runner.run("Access/MultiDimensionalArray/indices", size * sizeof(double), [&]()
+    {
+        double sum = 0;
+        for (const matioCpp::MultiIndex& index : array.indices())
+        {
+            sum += array(index);
+        }
+        doNotOptimize(sum);
+    });
+
+    matioCpp::FixedRankView<const double, 3> view(array);
+    runner.run("Access/FixedRankView/operator()", size * sizeof(double), [&]()
+    {
+        double sum = 0;
+        for (size_t k = 0; k < 10; ++k)
+        {
+            for (size_t j = 0; j < 10; ++j)
+            {
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    sum += view(i, j, k);
+                }
+            }
+        }
+        doNotOptimize(sum);
+    });
+
+    // Extract the 64x64x8 sub-tensor at the third index of the fourth dimension of a 5-D dataset
+    std::vector<double> datasetData(64 * 64 * 16 * 8 * 2, 1.0);
+    matioCpp::MultiDimensionalArray<double> dataset("dataset", {64, 64, 16, 8, 2}, datasetData.data());
+    std::vector<double> subTensor(64 * 64 * 8);
+    runner.run("Access/MultiDimensionalArray/slice/loop", subTensor.size() * sizeof(double), [&]()
+    {
+        size_t position = 0;
+        for (size_t k = 0; k < 16; k += 2)
+        {
+            for (size_t j = 0; j < 64; ++j)
+            {
+                for (size_t i = 0; i < 64; ++i)
+                {
+                    subTensor[position++] = dataset(i, j, k, 3, 1);
+                }
+            }
+        }
+        doNotOptimize(subTensor.data());
+    });
+
+    runner.run("Access/StridedView/copyTo", subTensor.size() * sizeof(double), [&]()
+    {
+        matioCpp::StridedView<const double> slice(dataset, {matioCpp::Slice(), matioCpp::Slice(), {0, 16, 2}, 3, 1});
+        slice.copyTo(matioCpp::make_span(subTensor));
+        doNotOptimize(subTensor.data());
+    });
+
+    matioCpp::Struct nested = makeNestedStruct(3, 10);
+    runner.run("Access/Struct/nested3", 0, [&]()
+    {
+        double value = nested("level2").asStruct()("level1").asStruct()("leaf").asStruct()("data").asVector<double>()(5);
+        doNotOptimize(value);
+    });
+
+    std::vector<matioCpp::Variable> manyFields;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        manyFields.emplace_back(matioCpp::Element<double>("field" + std::to_string(i), static_cast<double>(i)));
+    }
+    matioCpp::Struct wide("wide", manyFields);
+    const std::string lastField = "field199";
+    runner.run("Access/Struct/200fields/getFieldIndex", 0, [&]()
+    {
+        size_t index = wide.getFieldIndex(lastField);
+        doNotOptimize(index);
+    });
+
+    runner.run("Access/raw/Mat_VarGetStructFieldByName/nested3", 0, [&]()
+    {
+        const matvar_t* level = nested.toMatio();
+        for (const char* field : {"level2", "level1", "leaf", "data"})
+        {
+            level = Mat_VarGetStructFieldByName(const_cast<matvar_t*>(level), field, 0);
+        }
+        double value = static_cast<const double*>(level->data)[5];
+        doNotOptimize(value);
+    });
+
+    std::vector<matioCpp::Variable> cellElements;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        cellElements.emplace_back(matioCpp::Element<double>("element", static_cast<double>(i)));
+    }
+    matioCpp::CellArray cell("cell", {10, 10}, cellElements);
+    runner.run("Access/CellArray/10x10", 0, [&]()
+    {
+        double sum = 0;
+        for (size_t j = 0; j < 10; ++j)
+        {
+            for (size_t i = 0; i < 10; ++i)
+            {
+                sum += cell({i, j}).asElement<double>()();
+            }
+        }
+        doNotOptimize(sum);
+    });
+
+    matioCpp::StructArray structArray("array", {10, 10}, std::vector<matioCpp::Struct>(100, matioCpp::Struct("element", {matioCpp::Element<double>("x", 1.0)})));
+    runner.run("Access/StructArray/10x10", 0, [&]()
+    {
+        double sum = 0;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            sum += structArray(i)("x").asElement<double>()();
+        }
+        doNotOptimize(sum);
+    });
+
+    matioCpp::FieldHandle xField = structArray.getFieldHandle("x");
+    runner.run("Access/StructArray/10x10/FieldHandle", 0, [&]()
+    {
+        double sum = 0;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            sum += structArray(i)(xField).asElement<double>()();
+        }
+        doNotOptimize(sum);
+    });
+}
+
+void duplicateBenchmarks(Runner& runner)
+{
+    matioCpp::Vector<double> vector("vector", makeData(1000000));
+    runner.run("Duplicate/GetMatvarDuplicate/Vector/1000000", 1000000 * sizeof(double), [&]()
+    {
+        matvar_t* copy = matioCpp::MatvarHandler::GetMatvarDuplicate(vector.toMatio());
+        doNotOptimize(copy);
+        Mat_VarFree(copy);
+    });
+
+    runner.run("Duplicate/raw/Mat_VarDuplicate/Vector/1000000", 1000000 * sizeof(double), [&]()
+    {
+        matvar_t* copy = Mat_VarDuplicate(vector.toMatio(), 1);
+        doNotOptimize(copy);
+        Mat_VarFree(copy);
+    });
+
+    matioCpp::Struct nested = makeNestedStruct(3, 1000);
+    runner.run("Duplicate/GetMatvarDuplicate/Struct/nested3", 0, [&]()
+    {
+        matvar_t* copy = matioCpp::MatvarHandler::GetMatvarDuplicate(nested.toMatio());
+        doNotOptimize(copy);
+        Mat_VarFree(copy);
+    });
+
+    runner.run("Duplicate/Variable/copy/Struct/nested3", 0, [&]()
+    {
+        matioCpp::Variable copy(nested);
+        doNotOptimize(copy);
+    });
+}
+
+void rawFileBenchmarks(Runner& runner)
+{
+    const size_t size = 100000;
+    std::vector<double> data = makeData(size);
+    size_t bytes = size * sizeof(double);
+    matioCpp::Vector<double> vector("vector", data);
+
+    matioCpp::File::Delete(benchmarkFile);
+
+    runner.run("File/raw/Mat_VarWrite/MAT5/none/" + std::to_string(size), bytes, [&]()
+    {
+        mat_t* output = Mat_CreateVer(benchmarkFile.c_str(), NULL, MAT_FT_MAT5);
+        size_t dims[2] = {size, 1};
+        matvar_t* raw = Mat_VarCreate("vector", MAT_C_DOUBLE, MAT_T_DOUBLE, 2, dims, data.data(), MAT_F_DONT_COPY_DATA);
+        doNotOptimize(Mat_VarWrite(output, raw, MAT_COMPRESSION_NONE));
+        Mat_VarFree(raw);
+        Mat_Close(output);
+    });
+
+    runner.run("File/wrapper/write/MAT5/none/" + std::to_string(size), bytes, [&]()
+    {
+        matioCpp::File output = matioCpp::File::Create(benchmarkFile, matioCpp::FileVersion::MAT5);
+        doNotOptimize(output.write(vector));
+    });
+
+    mat_t* input = Mat_Open(benchmarkFile.c_str(), MAT_ACC_RDONLY);
+    if (input)
+    {
+        runner.run("File/raw/Mat_VarRead/MAT5/none/" + std::to_string(size), bytes, [&]()
+        {
+            matvar_t* raw = Mat_VarRead(input, "vector");
+            doNotOptimize(raw);
+            Mat_VarFree(raw);
+        });
+        Mat_Close(input);
+    }
+
+    matioCpp::File wrapperInput(benchmarkFile, matioCpp::FileMode::ReadOnly);
+    runner.run("File/wrapper/read/MAT5/none/" + std::to_string(size), bytes, [&]()
+    {
+        matioCpp::Variable read = wrapperInput.read("vector");
+        doNotOptimize(read);
+    });
+    wrapperInput.close();
+
+    matioCpp::File::Delete(benchmarkFile);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    Runner runner(argc, argv);
+
+    fileBenchmarks(runner);
+    rawFileBenchmarks(runner);
+    constructionBenchmarks(runner);
+    accessBenchmarks(runner);
+    duplicateBenchmarks(runner);
+
+    return runner.finish();
+}
@@ -0,0 +1,117 @@
+#ifndef MATIOCPP_ASYNCFILEWRITER_H
+#define MATIOCPP_ASYNCFILEWRITER_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+
+#include <matioCpp/ForwardDeclarations.h>
+#include <matioCpp/Variable.h>
+#include <matioCpp/File.h>
+#include <future>
+
+/**
+ * @brief Writes variables to a File from a background thread.
+ *
+ * The variables are stored in a queue and written to the file in the same order in which they have been passed.
+ * The calling thread never performs disk I/O or compression, hence the class can be used from time-critical loops.
+ * The File is owned by the writer and it should not be accessed until it is given back by close().
+ */
+class matioCpp::AsyncFileWriter
+{
+    class Impl;
+
+    std::unique_ptr<Impl> m_pimpl; /** Pointer to implementation. **/
+
+public:
+
+    /**
+     * @brief Constructor
+     * @param file The file where to write the variables. It has to be open in ReadAndWrite mode.
+     * @param maxQueueSize The maximum number of variables waiting to be written.
+     * @param policy The behavior when a variable is written while the queue is full.
+     */
+    AsyncFileWriter(matioCpp::File&& file, size_t maxQueueSize = 64,
+                    matioCpp::QueueFullPolicy policy = matioCpp::QueueFullPolicy::Block);
+
+    /**
+     * @brief Deleted copy constructor
+     */
+    AsyncFileWriter(const AsyncFileWriter& other) = delete;
+
+    /**
+     * @brief Deleted move constructor
+     */
+    AsyncFileWriter(AsyncFileWriter&& other) = delete;
+
+    /**
+     * @brief Destructor. It waits for the queued variables to be written.
+     */
+    ~AsyncFileWriter();
+
+    /**
+     * @brief Deleted copy assignment
+     */
+    void operator=(const AsyncFileWriter& other) = delete;
+
+    /**
+     * @brief Deleted move assignment
+     */
+    void operator=(AsyncFileWriter&& other) = delete;
+
+    /**
+     * @brief Queue a copy of a variable for writing
+     * @param variable The variable to write. It is copied, hence it can be modified as soon as the method returns.
+     * @param compression The compression type to be used for writing the variable.
+     * @return A future that becomes true once the variable has been written successfully.
+     * It is immediately false if the writer is closed, the variable is not valid, or it has been dropped because the queue is full.
+     */
+    std::future<bool> write(const matioCpp::Variable& variable, matioCpp::Compression compression = matioCpp::Compression::None);
+
+    /**
+     * @brief Queue a variable for writing, without copying it if possible
+     * @param variable The variable to write. If it is the only owner of its data, the data is moved in the queue.
+     * Otherwise, e.g. if it is a field of a struct or it shares its data with other variables, it is copied.
+     * @param compression The compression type to be used for writing the variable.
+     * @return A future that becomes true once the variable has been written successfully.
+     * It is immediately false if the writer is closed, the variable is not valid, or it has been dropped because the queue is full.
+     */
+    std::future<bool> write(matioCpp::Variable&& variable, matioCpp::Compression compression = matioCpp::Compression::None);
+
+    /**
+     * @brief Wait until all the queued variables have been written
+     * @return True if all the writes requested since the last flush have been successful, and none has been dropped.
+     */
+    bool flush();
+
+    /**
+     * @brief Write all the queued variables and stop the background thread
+     * @return The file that has been written. If the constructor rejected the file, it is given back as it was passed.
+     * It is invalid if close has already been called.
+     */
+    matioCpp::File close();
+
+    /**
+     * @brief Check if the writer is accepting new variables
+     * @return True if the writer has not been closed.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Get the number of variables waiting to be written
+     * @return The number of queued variables.
+     */
+    size_t queueSize() const;
+
+    /**
+     * @brief Get the number of variables dropped because the queue was full
+     * @return The total number of dropped variables.
+     */
+    size_t droppedWrites() const;
+};
+
+#endif // MATIOCPP_ASYNCFILEWRITER_H
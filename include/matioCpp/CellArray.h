@@ -10,6 +10,7 @@
 
 #include <matioCpp/ForwardDeclarations.h>
 #include <matioCpp/Variable.h>
+#include <matioCpp/MultiIndex.h>
 
 /**
  * @brief CellArray is a particular type of Variable specialized for cell arrays.
@@ -60,6 +61,20 @@ public:
      */
     CellArray(const std::string& name, const std::vector<index_type>& dimensions, std::vector<Variable> &elements);
 
+    /**
+     * @brief Constructor
+     * @param name The name of the CellArray
+     * @param dimensions The dimensions of the CellArray
+     * @param elements The elements to be moved in the CellArray
+     * @note An element is moved only if it is the only owner of its data, i.e. if no other variable is sharing it.
+     * In this case, the element becomes invalid. Otherwise, it is copied and left untouched.
+     * If the size of the vector does not match the dimensions, or one of the elements is not valid, an error is printed,
+     * none of the elements is moved and the CellArray is empty.
+     * @note The name of the variables in the vector is not used
+     * @note The vector is supposed to contain the variables in column-major format.
+     */
+    CellArray(const std::string& name, const std::vector<index_type>& dimensions, std::vector<Variable> &&elements);
+
     /**
      * @brief Copy constructor
      */
@@ -107,6 +122,18 @@ public:
      */
     bool fromVectorOfVariables(const std::vector<index_type>& dimensions, std::vector<Variable> &elements);
 
+    /**
+     * @brief Set from a vector of Variables, moving them
+     * @note The vector is supposed to contain the variables in column-major format.
+     * @note The name of the variables is not used
+     * @note An element is moved only if it is the only owner of its data, i.e. if no other variable is sharing it.
+     * In this case, the element becomes invalid. Otherwise, it is copied and left untouched.
+     * @param dimensions The input dimensions
+     * @param elements The input vector of variables.
+     * @return True if successful. False otherwise, for example if one of the input variables is not valid.
+     */
+    bool fromVectorOfVariables(const std::vector<index_type>& dimensions, std::vector<Variable> &&elements);
+
     /**
      * @brief Get the linear index corresponding to the provided indices
      * @param el The desired element
@@ -120,6 +147,16 @@ public:
      */
     index_type rawIndexFromIndices(const std::vector<index_type>& el) const;
 
+    /**
+     * @brief Get the index in the vectorized array corresponding to the provided indices
+     * @param el The desired element. The number of indices has to be equal to the number of dimensions.
+     * @warning It checks if the element is in the bounds only in debug mode.
+     * @note Differently from the version taking a std::vector, it does not allocate memory.
+     * @return the index in the vectorized array corresponding to the provided indices
+     */
+    template<size_t N>
+    index_type rawIndexFromIndices(const std::array<index_type, N>& el) const;
+
     /**
      * @brief Get the indices given the raw index
      * @param rawIndex The input raw index from which to compute the indices
@@ -129,6 +166,15 @@ public:
      */
     bool indicesFromRawIndex(size_t rawIndex, std::vector<index_type>& el) const;
 
+    /**
+     * @brief Get the indices of all the elements, to be iterated in column-major order
+     *
+     * The indices are updated incrementally while iterating. Each MultiIndex also provides the raw index,
+     * hence it can be used to access the elements without computing their position again.
+     * @return The range of indices.
+     */
+    matioCpp::MultiIndexRange indices() const;
+
     /**
      * @brief Change the name of the Variable
      * @param newName The new name
@@ -138,12 +184,52 @@ public:
 
     /**
      * @brief Resize the cell array.
-     * @param newDimensions The new dimensions.
      *
-     * @warning Previous data is lost.
+     * The elements whose indices are within the new dimensions are kept, without copying them. The other elements are deleted.
+     * The new elements are empty.
+     * @param newDimensions The new dimensions.
      */
     void resize(const std::vector<index_type>& newDimensions);
 
+    /**
+     * @brief Add an element at the end of the cell array
+     *
+     * The cell array needs to have a single row or a single column. The amortized cost does not depend on the number of elements.
+     * @param newValue The Variable that will be copied at the end of the cell array.
+     * @return True if successful, false otherwise, for example if the cell array is a matrix.
+     */
+    bool push_back(const Variable& newValue);
+
+    /**
+     * @brief Add an element at the end of the cell array
+     *
+     * The cell array needs to have a single row or a single column. The amortized cost does not depend on the number of elements.
+     * @param newValue The Variable that will be moved at the end of the cell array.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. In this case, it becomes invalid.
+     * Otherwise, it is copied.
+     * @return True if successful, false otherwise, for example if the cell array is a matrix.
+     */
+    bool push_back(Variable&& newValue);
+
+    /**
+     * @brief Add elements at the end of the cell array
+     *
+     * The cell array needs to have a single row or a single column.
+     * @param newValues The Variables that will be copied at the end of the cell array.
+     * @return True if successful, false otherwise, for example if one of the new values is not valid. In this case, the cell array is not modified.
+     */
+    bool append(const std::vector<Variable>& newValues);
+
+    /**
+     * @brief Add elements at the end of the cell array
+     *
+     * The cell array needs to have a single row or a single column.
+     * @param newValues The Variables that will be moved at the end of the cell array.
+     * A Variable is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True if successful, false otherwise, for example if one of the new values is not valid. In this case, the cell array is not modified.
+     */
+    bool append(std::vector<Variable>&& newValues);
+
     /**
      * @brief Clear the cell array
      */
@@ -173,6 +259,26 @@ public:
      */
     bool setElement(index_type el, const Variable& newValue);
 
+    /**
+     * @brief Set the element at the specified position
+     * @param el The indices of the specified element
+     * @param newValue The Variable that will be moved in the specified location.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True if successful, false otherwise (for example if the newValue is not valid)
+     * @note An assertion is thrown if el is out of bounds, but only in debug mode
+     */
+    bool setElement(const std::vector<index_type>& el, Variable&& newValue);
+
+    /**
+     * @brief Set the element at the specified position
+     * @param el The raw index of the specified element
+     * @param newValue The Variable that will be moved in the specified location.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True if successful, false otherwise (for example if the newValue is not valid)
+     * @note An assertion is thrown if el is out of bounds, but only in debug mode
+     */
+    bool setElement(index_type el, Variable&& newValue);
+
     /**
      * @brief Access specified element.
      * @param el The element to be accessed.
@@ -236,6 +342,99 @@ public:
      * @return A const Variable with a weak ownership to the underlying mat variable.
      */
     const matioCpp::Variable operator[](index_type el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param i0 The index along the first dimension.
+     * @param i1 The index along the second dimension.
+     * @param others The indices along the other dimensions.
+     * @warning The number of indices has to be equal to the number of dimensions. Each index has to be strictly smaller than the corresponding dimension.
+     * @return A Variable with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the variable cannot be resized and the name cannot change.
+     */
+    template<typename... Indices>
+    matioCpp::Variable operator()(index_type i0, index_type i1, Indices... others);
+
+    /**
+     * @brief Access specified element.
+     * @param i0 The index along the first dimension.
+     * @param i1 The index along the second dimension.
+     * @param others The indices along the other dimensions.
+     * @warning The number of indices has to be equal to the number of dimensions. Each index has to be strictly smaller than the corresponding dimension.
+     * @return A const Variable with a weak ownership to the underlying mat variable.
+     */
+    template<typename... Indices>
+    const matioCpp::Variable operator()(index_type i0, index_type i1, Indices... others) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A Variable with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the variable cannot be resized and the name cannot change.
+     */
+    template<size_t N>
+    matioCpp::Variable operator()(const std::array<index_type, N>& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A const Variable with a weak ownership to the underlying mat variable.
+     */
+    template<size_t N>
+    const matioCpp::Variable operator()(const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A Variable with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the variable cannot be resized and the name cannot change.
+     */
+    template<size_t N>
+    matioCpp::Variable operator[](const std::array<index_type, N>& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A const Variable with a weak ownership to the underlying mat variable.
+     */
+    template<size_t N>
+    const matioCpp::Variable operator[](const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A Variable with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the variable cannot be resized and the name cannot change.
+     */
+    matioCpp::Variable operator()(const matioCpp::MultiIndex& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A const Variable with a weak ownership to the underlying mat variable.
+     */
+    const matioCpp::Variable operator()(const matioCpp::MultiIndex& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A Variable with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the variable cannot be resized and the name cannot change.
+     */
+    matioCpp::Variable operator[](const matioCpp::MultiIndex& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A const Variable with a weak ownership to the underlying mat variable.
+     */
+    const matioCpp::Variable operator[](const matioCpp::MultiIndex& el) const;
 };
 
+#include "impl/CellArray.tpp"
+
 #endif // MATIOCPP_CELLARRAY_H
@@ -14,6 +14,7 @@
 
 #include <matioCpp/Vector.h>
 #include <matioCpp/MultiDimensionalArray.h>
+#include <matioCpp/Tracing.h>
 
 #include <Eigen/Core>
 
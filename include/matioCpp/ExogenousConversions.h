@@ -15,6 +15,7 @@
 #include <matioCpp/Span.h>
 #include <matioCpp/Vector.h>
 #include <matioCpp/MultiDimensionalArray.h>
+#include <matioCpp/Tracing.h>
 
 #include <visit_struct/visit_struct_intrusive.hpp>
 
@@ -33,6 +34,16 @@ template <class Vector, typename = typename std::enable_if_t<is_vector_compatibl
                                                              !std::is_same<Vector, std::string>::value>>
 inline matioCpp::Vector<typename std::remove_cv_t<typename  matioCpp::SpanUtils::container_data<Vector>::type>> make_variable(const std::string& name, const Vector& input);
 
+/**
+ * @brief Conversion from a std::vector to a matioCpp::Vector, adopting its storage
+ * @param name The name of the resulting matioCpp variable.
+ * @param input The input vector.
+ * @return A matioCpp::Vector using the storage of the input vector, without copying it
+ */
+template <typename type, typename = typename std::enable_if_t<std::is_arithmetic<type>::value &&
+                                                             !std::is_same<type, bool>::value>>
+inline matioCpp::Vector<type> make_variable(const std::string& name, std::vector<type>&& input);
+
 /**
  * @brief Conversion from a std::string to a matioCpp::String
  * @param name The name of the resulting matioCpp variable.
@@ -88,6 +99,7 @@ inline matioCpp::Struct make_variable(const std::string& name, const Struct& inp
  * @brief Create a matioCpp::Struct starting from the begin and end iterators of a map-like container
  * The dereferenced value of the iterator has to be a pair (like with std::maps and std::unordered_map)
  * with the key being a string. For each key, there is the corresponding field in the Struct.
+ * If a key is repeated (like with std::multimap or a vector of pairs), the last value is used.
  * @param name The name of the struct.
  * @param begin The iterator to the first element
  * @param end The iterator to the element after the last.
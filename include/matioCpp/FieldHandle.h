@@ -0,0 +1,71 @@
+#ifndef MATIOCPP_FIELDHANDLE_H
+#define MATIOCPP_FIELDHANDLE_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/ForwardDeclarations.h>
+
+/**
+ * @brief A field of a StructArray, resolved once by name.
+ *
+ * It can be used to access the same field of many elements of the array, without searching the field name every time.
+ * The handle remains valid as long as no field is added to the array and the array is not resized or reassigned.
+ */
+class matioCpp::FieldHandle
+{
+    std::string m_name; /** The name of the field. **/
+
+    size_t m_index{0}; /** The position of the field. **/
+
+    bool m_valid{false}; /** True if the field has been found. **/
+
+    const matvar_t* m_array{nullptr}; /** The array in which the field has been resolved. **/
+
+public:
+
+    /**
+     * @brief Default constructor. The handle is not valid.
+     */
+    FieldHandle() = default;
+
+    /**
+     * @brief Resolve a field of a StructArray
+     * @param array The array.
+     * @param field The name of the field.
+     */
+    FieldHandle(const matioCpp::StructArray& array, const std::string& field);
+
+    /**
+     * @brief Check if the field has been found
+     * @return True if the field exists in the array.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Get the name of the field
+     * @return The name of the field.
+     */
+    const std::string& name() const;
+
+    /**
+     * @brief Get the position of the field
+     * @return The position of the field in the array. It is meaningful only if the handle is valid.
+     */
+    size_t index() const;
+
+    /**
+     * @brief Check if the handle can be used with the specified array
+     *
+     * It verifies that the handle has been resolved in the same array, and that the field has not moved.
+     * @param array The array to check.
+     * @return True if the handle is valid for the input array.
+     */
+    bool isValidFor(const matioCpp::StructArray& array) const;
+};
+
+#endif // MATIOCPP_FIELDHANDLE_H
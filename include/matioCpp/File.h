@@ -11,6 +11,7 @@
 
 #include <matioCpp/ForwardDeclarations.h>
 #include <matioCpp/Variable.h>
+#include <matioCpp/VariableInfo.h>
 
 class matioCpp::File
 {
@@ -37,6 +38,26 @@ class matioCpp::File
     template<class key, class input>
     inline const input &getVariable(const std::pair<key, input>& it);
 
+    /**
+     * @brief Type-erased implementation of appendRows.
+     * @param name The name of the appendable variable.
+     * @param data Pointer to the first element of the rows to append.
+     * @param numberOfElements The number of elements pointed by data.
+     * @param inputType The type of the input elements.
+     * @return True if successful.
+     */
+    bool appendRowsImpl(const std::string& name, const void* data, size_t numberOfElements, matioCpp::ValueType inputType);
+
+    /**
+     * @brief Write a batch of variables.
+     *
+     * When using zlib compression on a MAT5 file, the variables are compressed in parallel and then appended to the file in order.
+     * @param variables Pointers to the variables to be written.
+     * @param compression The compression type to be used for writing the variables.
+     * @return True if successful.
+     */
+    bool writeBatch(const std::vector<const matioCpp::Variable*>& variables, matioCpp::Compression compression);
+
 public:
 
     /**
@@ -154,6 +175,19 @@ public:
      */
     std::vector<std::string> variableNames() const;
 
+    /**
+     * @brief Get the description of a variable without reading its data
+     * @param name The name of the variable
+     * @return The description of the variable. The method isValid() would return false if something went wrong.
+     */
+    matioCpp::VariableInfo info(const std::string& name) const;
+
+    /**
+     * @brief Get the description of all the variables in the file without reading their data
+     * @return The list of descriptions, in the same order in which the variables are stored in the file.
+     */
+    std::vector<matioCpp::VariableInfo> schema() const;
+
     /**
      * @brief Read a variable given the name
      * @param name The name of the variable to be read
@@ -162,6 +196,61 @@ public:
      */
     matioCpp::Variable read(const std::string& name) const;
 
+    /**
+     * @brief Read several variables in parallel
+     *
+     * Each worker thread opens the file with an independent read-only handle, so that the variables
+     * can be read and decompressed concurrently.
+     * @param names The names of the variables to be read
+     * @param threads The maximum number of threads to use. If zero, the number of concurrent threads supported by the hardware is used.
+     * @return The desired variables, in the same order of the input names. A variable is not valid if it could not be read.
+     * @note MAT 7.3 files, and files that have been written since they have been opened, are read serially.
+     */
+    std::vector<matioCpp::Variable> readMany(const std::vector<std::string>& names, size_t threads = 0) const;
+
+    /**
+     * @brief Read a hyperslab of a numeric variable
+     *
+     * Only the requested elements are read from the file, without loading the whole variable in memory.
+     * For each dimension i, the elements start[i], start[i] + stride[i], ..., start[i] + (count[i] - 1) * stride[i] are read.
+     * @param name The name of the variable to be read
+     * @param start The index of the first element to read along each dimension.
+     * @param stride The step between two consecutive elements along each dimension.
+     * @param count The number of elements to read along each dimension. It defines the dimensions of the output.
+     * @return The desired Variable, having dimensions equal to count. The method isValid() would return false if something went wrong.
+     * @note Only real numeric and logical variables are supported.
+     */
+    matioCpp::Variable read(const std::string& name, const std::vector<size_t>& start,
+                            const std::vector<size_t>& stride, const std::vector<size_t>& count) const;
+
+    /**
+     * @brief Read a subset of the elements of a numeric variable, using linear indexing
+     *
+     * Only the elements start, start + stride, ..., start + (count - 1) * stride are read from the file.
+     * @param name The name of the variable to be read
+     * @param start The linear index (column-major) of the first element to read.
+     * @param stride The step between two consecutive elements.
+     * @param count The number of elements to read.
+     * @return A Variable of dimensions count x 1. The method isValid() would return false if something went wrong.
+     * @note Only real numeric and logical variables are supported.
+     */
+    matioCpp::Variable readLinear(const std::string& name, size_t start, size_t stride, size_t count) const;
+
+    /**
+     * @brief Read a numeric variable by mapping the file in memory
+     *
+     * The data of the output variable points directly to the mapped file, hence no memory is allocated
+     * and no data is copied. The mapped pages are shared with the other processes mapping the same file.
+     * The file remains mapped as long as there are variables using it, even if the file is closed.
+     * @param name The name of the variable to be read
+     * @return The desired Variable, of type MultiDimensionalArray. It can be converted to a Vector or an Element as usual,
+     * and the underlying data can be accessed through toSpan(). The method isValid() would return false if the variable cannot be mapped.
+     * @note Only real numeric and logical variables stored uncompressed in MAT5 files, written with the same endianness of the machine, can be mapped.
+     * In the other cases, the variable can be loaded with read.
+     * @note Modifying the output variable will not change the file.
+     */
+    matioCpp::Variable readMapped(const std::string& name) const;
+
     /**
      * @brief Write a Variable to a file
      * @param variable The input variable.
@@ -173,6 +262,9 @@ public:
 
     /**
      * @brief Write a Variable to a file in a batch
+     *
+     * When using zlib compression on a MAT5 file, the variables are compressed in parallel
+     * and then appended to the file, in the same order of the input.
      * @param begin Iterator to the first element to be written
      * @param end Iterator to the first element that is not written
      * @param compression The compression type to be used for writing the variable.
@@ -181,6 +273,57 @@ public:
     template <class iterator>
     bool write(iterator begin, iterator end, matioCpp::Compression compression = matioCpp::Compression::None);
 
+    /**
+     * @brief Create a variable to which rows can be appended over time
+     *
+     * The variable is a matrix with a fixed number of columns, stored as an extendible and chunked dataset.
+     * Rows passed to appendRows are buffered in memory and written to the file every chunkRows rows,
+     * hence the memory usage is bounded by the chunk size.
+     * @param name The name of the variable. It must not exist already in the file.
+     * @param valueType The type of the elements. Only numeric and LOGICAL types are supported.
+     * @param columns The number of columns of the variable, i.e. the number of elements in each row.
+     * @param chunkRows The number of rows that are buffered before writing them to the file.
+     * @param compression The compression type to be used for writing the data.
+     * @note This is available only for MAT7_3 files and requires matio >= 1.5.13.
+     * @warning Writing a chunk passes the data to the HDF5 library, but matio does not provide a way to force the HDF5 data
+     * and metadata to disk. If the process crashes before the file is closed, the whole file may be unreadable, not only
+     * the last chunk. Close the file to make sure it is consistent on disk.
+     * @return True if successful.
+     */
+    bool createAppendable(const std::string& name, matioCpp::ValueType valueType, size_t columns,
+                          size_t chunkRows = 1024, matioCpp::Compression compression = matioCpp::Compression::None);
+
+    /**
+     * @brief Append rows to a variable created with createAppendable
+     * @param name The name of the appendable variable.
+     * @param rows The rows to append, one after the other (row-major). The size has to be a multiple of the number of columns.
+     * @return True if successful. The rows are written to the file once a chunk is full, or when flushing.
+     */
+    template <typename T>
+    bool appendRows(const std::string& name, const matioCpp::Span<T>& rows);
+
+    /**
+     * @brief Write the rows buffered for the specified appendable variable to the file
+     * @param name The name of the appendable variable.
+     * @note The rows are passed to the HDF5 library, but they are not guaranteed to be on disk until the file is closed.
+     * @return True if successful.
+     */
+    bool flush(const std::string& name);
+
+    /**
+     * @brief Write the rows buffered for all the appendable variables to the file
+     * @note The rows are passed to the HDF5 library, but they are not guaranteed to be on disk until the file is closed.
+     * @return True if successful.
+     */
+    bool flush();
+
+    /**
+     * @brief Flush the specified appendable variable and stop accepting new rows for it
+     * @param name The name of the appendable variable.
+     * @return True if successful.
+     */
+    bool closeAppendable(const std::string& name);
+
     /**
      * @brief Check if the file is open
      * @return True if open.
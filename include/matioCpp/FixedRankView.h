@@ -0,0 +1,206 @@
+#ifndef MATIOCPP_FIXEDRANKVIEW_H
+#define MATIOCPP_FIXEDRANKVIEW_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/ForwardDeclarations.h>
+#include <matioCpp/ConversionUtilities.h>
+#include <matioCpp/Span.h>
+#include <matioCpp/Variable.h>
+#include <matioCpp/MultiDimensionalArray.h>
+#include <matioCpp/MultiIndex.h>
+
+/**
+ * @brief FixedRankView is a non-owning view of the data of a numeric Variable, whose number of dimensions N is known at compile time.
+ *
+ * The type and the dimensions of the variable are checked once, when the view is created. Then, the dimensions and the strides
+ * are stored in a std::array, so that accessing an element does not involve any check or call to the variable, and loops over
+ * the elements can be unrolled and vectorized by the compiler.
+ * Use a const type T, e.g. FixedRankView<const double, 2>, to obtain a read-only view.
+ * @note The data is in column-major format, and the first dimension is contiguous.
+ * @warning The view points directly to the data of the variable. It does not keep the variable alive, and it becomes dangling
+ * if the variable is deallocated, resized or reassigned.
+ */
+template<typename T, size_t N>
+class matioCpp::FixedRankView
+{
+    static_assert (N > 0, "The rank of a FixedRankView should be at least 1.");
+
+public:
+
+    using type = T; /** Defines the type specified in the template. **/
+
+    using value_type = std::remove_cv_t<T>; /** Defines the type T without "const". **/
+
+    using element_type = std::conditional_t<std::is_const<T>::value,
+                                            const typename get_type<value_type>::type,
+                                            typename get_type<value_type>::type>; /** Defines the type of an element of the view. **/
+
+    using index_type = size_t; /** The type used for indices. **/
+
+    using reference = element_type&; /** The reference type. **/
+
+    using pointer = element_type*; /** The pointer type. **/
+
+private:
+
+    pointer m_data{nullptr}; /** The data of the variable. **/
+
+    std::array<index_type, N> m_dimensions; /** The size of each dimension. **/
+
+    std::array<index_type, N> m_strides; /** The distance between two consecutive elements along each dimension. **/
+
+    index_type m_numberOfElements{0}; /** The total number of elements. **/
+
+    bool m_valid{false}; /** True if the view has been initialized successfully. **/
+
+    /**
+     * @brief Initialize the view
+     * @param data The data of the variable.
+     * @param dimensions The dimensions of the variable.
+     * @return True if the dimensions are compatible with the rank N.
+     */
+    bool initialize(pointer data, matioCpp::Span<const size_t> dimensions);
+
+    /**
+     * @brief Check if the type of a Variable is compatible with the view
+     * @param variable The variable to check.
+     * @return True if compatible. False otherwise, printing an error.
+     */
+    static bool checkCompatibility(const matioCpp::Variable& variable);
+
+public:
+
+    /**
+     * @brief Default constructor. The view is not valid.
+     */
+    FixedRankView();
+
+    /**
+     * @brief Constructor from a Variable
+     *
+     * The variable can be a MultiDimensionalArray, a Vector or an Element, whose value type is compatible with T.
+     * Its number of dimensions has to be N. Additional trailing dimensions are accepted if they are equal to 1,
+     * while missing dimensions are considered equal to 1.
+     * @param variable The variable to view. If it is not compatible, an error is printed and the view is not valid.
+     */
+    FixedRankView(matioCpp::Variable& variable);
+
+    /**
+     * @brief Constructor from a const Variable. Available only for const types.
+     * @param variable The variable to view. If it is not compatible, an error is printed and the view is not valid.
+     */
+    template<typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+    FixedRankView(const matioCpp::Variable& variable);
+
+    /**
+     * @brief Constructor from a MultiDimensionalArray
+     * @param array The array to view. Its number of dimensions has to be compatible with N.
+     */
+    FixedRankView(matioCpp::MultiDimensionalArray<value_type>& array);
+
+    /**
+     * @brief Constructor from a const MultiDimensionalArray. Available only for const types.
+     * @param array The array to view. Its number of dimensions has to be compatible with N.
+     */
+    template<typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+    FixedRankView(const matioCpp::MultiDimensionalArray<value_type>& array);
+
+    /**
+     * @brief Check if the view has been created successfully
+     * @return True if the view refers to the data of a variable.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Get the number of dimensions
+     * @return The number of dimensions N.
+     */
+    static constexpr size_t rank();
+
+    /**
+     * @brief Get the dimensions
+     * @return The size of each dimension.
+     */
+    const std::array<index_type, N>& dimensions() const;
+
+    /**
+     * @brief Get the strides
+     * @return The distance, in number of elements, between two consecutive elements along each dimension.
+     */
+    const std::array<index_type, N>& strides() const;
+
+    /**
+     * @brief Get the total number of elements
+     * @return The total number of elements.
+     */
+    index_type numberOfElements() const;
+
+    /**
+     * @brief Direct access to the underlying data.
+     * @note The underlying data is in column-major format.
+     * @return A pointer to the data.
+     */
+    pointer data() const;
+
+    /**
+     * @brief Get the data as a Span
+     */
+    matioCpp::Span<element_type> toSpan() const;
+
+    /**
+     * @brief Get the index in the data corresponding to the provided indices
+     * @param el The desired element
+     * @warning It checks if the element is in the bounds only in debug mode.
+     * @return the index in the data corresponding to the provided indices
+     */
+    index_type rawIndexFromIndices(const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param indices The index along each dimension. Their number has to be equal to N.
+     * @warning Each index has to be strictly smaller than the corresponding dimension. This is checked only in debug mode.
+     * @return A reference to the element.
+     */
+    template<typename... Indices>
+    reference operator()(Indices... indices) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension. This is checked only in debug mode.
+     * @return A reference to the element.
+     */
+    reference operator()(const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from the indices() method of the viewed array. Its raw index is used directly.
+     * @return A reference to the element.
+     */
+    reference operator()(const matioCpp::MultiIndex& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension. This is checked only in debug mode.
+     * @return A reference to the element.
+     */
+    reference operator[](const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from the indices() method of the viewed array. Its raw index is used directly.
+     * @return A reference to the element.
+     */
+    reference operator[](const matioCpp::MultiIndex& el) const;
+};
+
+#include "impl/FixedRankView.tpp"
+
+#endif // MATIOCPP_FIXEDRANKVIEW_H
@@ -9,12 +9,15 @@
  */
 #include <algorithm> // for lexicographical_compare
 #include <array>     // for array
+#include <atomic>
 #include <cassert>
 #include <cctype> // for isalpha, isalnum
 #include <complex>
 #include <cstddef>   // for ptrdiff_t, size_t, nullptr_t
 #include <cstdio>  //for remove
 #include <cstring> //for memcpy
+#include <deque>
+#include <functional> // for less
 #include <initializer_list>
 #include <iostream>
 #include <iterator>  // for reverse_iterator, distance, random_access_...
@@ -160,6 +163,25 @@ enum class DeleteMode
     Delete /** The handler deletes the pointer. **/
 };
 
+/**
+ * @brief Define how the data passed to a variable constructor is handled.
+ */
+enum class DataOwnership
+{
+    Copy, /** The data is copied into memory allocated by matio. **/
+    Borrow /** The variable points directly to the input data, which is not copied nor deallocated. **/
+};
+
+/**
+ * @brief The behavior of an AsyncFileWriter when its queue is full.
+ */
+enum class QueueFullPolicy
+{
+    Block, /** The caller waits until a queued write is completed. **/
+    Drop, /** The variable is discarded and the write fails. **/
+    Grow /** The queue grows beyond its maximum size. **/
+};
+
 /**
  * @brief Utility class to consider logical values.
  */
@@ -185,6 +207,8 @@ class WeakMatvar;
 
 class Variable;
 
+class VariableInfo;
+
 template<typename T>
 class Element;
 
@@ -204,10 +228,32 @@ class CellArray;
 
 class File;
 
+class AsyncFileWriter;
+
+class Statistics;
+
+class Tracing;
+
 class Struct;
 
 class StructArray;
 
+class FieldHandle;
+
+class MultiIndex;
+
+class MultiIndexIterator;
+
+class MultiIndexRange;
+
+template<typename T, size_t N>
+class FixedRankView;
+
+class Slice;
+
+template<typename T>
+class StridedView;
+
 template <bool isConst>
 class StructArrayElement;
 
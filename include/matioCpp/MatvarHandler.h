@@ -16,7 +16,7 @@ protected:
 
     class PointerInfo
     {
-        matvar_t* m_ptr; /** The matvar_t pointer. **/
+        matvar_t* m_ptr{nullptr}; /** The matvar_t pointer. **/
 
         VariableType m_varType{VariableType::Unsupported}; /** The corresponding variable type. **/
 
@@ -24,6 +24,8 @@ protected:
 
         DeleteMode m_mode; /** The deletion mode. **/
 
+        std::shared_ptr<void> m_dataOwner; /** Optional object owning the data pointed by the matvar_t. It is released when the pointer is deleted. **/
+
     public:
 
         /**
@@ -35,8 +37,9 @@ protected:
          * @brief Constructor
          * @param ptr The input pointer
          * @param deleteMode The deletion mode
+         * @param dataOwner Optional object owning the data of ptr
          */
-        PointerInfo(matvar_t* ptr, DeleteMode deleteMode);
+        PointerInfo(matvar_t* ptr, DeleteMode deleteMode, std::shared_ptr<void> dataOwner = nullptr);
 
         /**
          * Destructor
@@ -47,11 +50,12 @@ protected:
          * @brief Change the input pointer
          * @param ptr The new pointer
          * @param deleteMode The corresponding deletion mode
+         * @param dataOwner Optional object owning the data of ptr
          */
-        void changePointer(matvar_t* ptr, DeleteMode deleteMode);
+        void changePointer(matvar_t* ptr, DeleteMode deleteMode, std::shared_ptr<void> dataOwner = nullptr);
 
         /**
-         * @brief Delete the matvar pointer
+         * @brief Delete the matvar pointer and release the owner of its data, if any
          */
         void deletePointer();
 
@@ -94,15 +98,26 @@ protected:
         static void DeletePointer(matvar_t *ptr, DeleteMode deleteMode);
     };
 
+    /**
+     * @brief A node of the dependency tree of an Ownership. The nodes refer to each other through their index.
+     */
     struct Dependency
     {
-        std::unordered_set<matvar_t*> dependencies; /** The set of dependencies. **/
+        matvar_t* pointer{nullptr}; /** The owned pointer. Null if the node is not used. **/
+
+        matioCpp::DeleteMode mode{matioCpp::DeleteMode::DoNotDelete}; /** Deletion mode for the dependency. **/
+
+        size_t parent; /** The index of the parent node. NoDependency if there is no parent (or if the parent is the main pointer). **/
 
-        matioCpp::DeleteMode mode; /** Deletion mode for the dependency. **/
+        size_t firstChild; /** The index of the first dependency of this node. NoDependency if there are none. **/
 
-        matvar_t* parent{nullptr}; /** The parent of the pointer. Null if there is no parent (or if the parent is the main pointer) **/
+        size_t previousSibling; /** The index of the previous node with the same parent. NoDependency if this is the first one. **/
+
+        size_t nextSibling; /** The index of the next node with the same parent, or of the next free node if the node is not used. **/
     };
 
+    static constexpr size_t NoDependency = std::numeric_limits<size_t>::max(); /** Index used to denote the absence of a node. **/
+
     /**
      * @brief The Ownership class is used to define the ownership of a matvar. SharedMatvar and WeakMatvar have a shared_ptr and a weak_ptr to it respectively.
      */
@@ -110,13 +125,49 @@ protected:
     {
         std::weak_ptr<PointerInfo> m_main; /** A pointer to the main PointerInfo that contains the pointer to be freed when the corresponding ownership is deallocated. It is the one owning the pointers in the other two sets. **/
 
-        std::unordered_map<matvar_t*, Dependency> m_dependencyTree; /** A map that links a pointer to its Dependency object. **/
+        std::vector<Dependency> m_dependencyTree; /** The nodes of the dependency tree. The unused nodes are kept for reuse. **/
+
+        size_t m_firstFree{NoDependency}; /** The index of the first unused node. The others are linked through nextSibling. **/
+
+        size_t m_numberOfDependencies{0}; /** The number of used nodes. **/
+
+        std::vector<size_t> m_lookup; /** Open addressing hash table (with linear probing) storing the index of the node of each owned pointer. **/
+
+        std::unordered_map<const matvar_t*, std::unordered_map<std::string, size_t>> m_fieldIndices; /** The position of the fields of the structs with many fields, indexed by name. **/
+
+        std::shared_ptr<std::atomic<uint64_t>> m_generation; /** Counter of the changes to the pointers of this ownership. It is shared with the handlers, hence it can be read also after the ownership has been deallocated. **/
+
+        /**
+         * @brief Get the slot of m_lookup where the search of a pointer starts
+         * @param pointer The pointer to search.
+         * @return The index of the slot.
+         */
+        size_t homeSlot(const matvar_t* pointer) const;
 
         /**
-         * @brief Drops all the dependencies of a given pointer
-         * @param previouslyOwned The pointer whose dependencies have to be dropped.
+         * @brief Find the slot of m_lookup containing a pointer
+         * @param pointer The pointer to search.
+         * @return The index of the slot, or NoDependency if the pointer is not owned.
          */
-        void dropDependencies(matvar_t* previouslyOwned);
+        size_t findSlot(const matvar_t* pointer) const;
+
+        /**
+         * @brief Add a node to m_lookup, enlarging it if necessary
+         * @param node The index of the node.
+         */
+        void insertInLookup(size_t node);
+
+        /**
+         * @brief Remove a slot from m_lookup, moving back the following entries of the same cluster
+         * @param slot The slot to remove.
+         */
+        void eraseFromLookup(size_t slot);
+
+        /**
+         * @brief Deletes a node and all its dependencies, without unlinking it from its parent
+         * @param node The index of the node to drop.
+         */
+        void dropDependencies(size_t node);
 
     public:
 
@@ -157,6 +208,38 @@ protected:
          * @brief Drops all the previously owned pointers and free those that need to be deallocated, including the main one.
          */
         void dropAll();
+
+        /**
+         * @brief Give up the main pointer without deleting it, and drop all the other pointers.
+         * @return The main pointer.
+         */
+        matvar_t* releaseMain();
+
+        /**
+         * @brief Get the position of a field of a struct, building the index of its fields if necessary
+         * @param structPointer The pointer to the struct. It has to be the main pointer or an owned pointer.
+         * @param field The name of the field.
+         * @param index The position of the field, or the number of fields if not found.
+         * @return True if the field has been found.
+         */
+        bool getStructFieldIndex(matvar_t* structPointer, const std::string& field, size_t& index);
+
+        /**
+         * @brief Discard the index of the fields of a struct
+         * @param structPointer The pointer to the struct.
+         */
+        void invalidateStructFieldIndex(const matvar_t* structPointer);
+
+        /**
+         * @brief Increment the generation counter. It has to be called every time a pointer of this ownership is replaced, dropped or deleted.
+         */
+        void nextGeneration();
+
+        /**
+         * @brief Get the generation counter
+         * @return A shared pointer to the counter. Its value is never zero.
+         */
+        const std::shared_ptr<std::atomic<uint64_t>>& generation() const;
     };
 
     /**
@@ -166,6 +249,17 @@ protected:
      */
     std::shared_ptr<PointerInfo> m_ptr;
 
+    /**
+     * @brief The generation counter of the ownership. It is null if the handler does not refer to any ownership.
+     */
+    std::shared_ptr<const std::atomic<uint64_t>> m_generation;
+
+    /**
+     * @brief Get the ownership object shared by all the handlers of the same matvar_t
+     * @return A pointer to the ownership object. It is null if the owner has been deallocated.
+     */
+    virtual std::shared_ptr<Ownership> lockOwnership() const = 0;
+
 public:
 
     /**
@@ -179,8 +273,9 @@ public:
      * @brief Constructor from an already existing matvar_t pointer
      * @param inputPtr The input matvar_t pointer
      * @param deleteMode The mode with which the pointer has to be deleted
+     * @param dataOwner Optional object owning the data of inputPtr. It is kept alive until inputPtr is deleted.
      */
-    MatvarHandler(matvar_t *inputPtr, matioCpp::DeleteMode deleteMode = matioCpp::DeleteMode::Delete);
+    MatvarHandler(matvar_t *inputPtr, matioCpp::DeleteMode deleteMode = matioCpp::DeleteMode::Delete, std::shared_ptr<void> dataOwner = nullptr);
 
     /**
      * @brief Copy constructor
@@ -221,9 +316,12 @@ public:
     /**
      * @brief Import the input pointer.
      * @param inputPtr The input pointer
+     * @param deleteMode The mode with which the pointer has to be deleted
+     * @param dataOwner Optional object owning the data of inputPtr. It is kept alive until inputPtr is deleted.
+     * This allows inputPtr to point to memory that has not been allocated by matio, using DeleteMode::ShallowDelete.
      * @return True if successful, false otherwise (e.g. if isShared is false, or the input pointer is null).
      */
-    virtual bool importMatvar(matvar_t* inputPtr) = 0;
+    virtual bool importMatvar(matvar_t* inputPtr, matioCpp::DeleteMode deleteMode = matioCpp::DeleteMode::Delete, std::shared_ptr<void> dataOwner = nullptr) = 0;
 
     /**
      * @brief Get a pointer to a duplicate of the MatvarHandler. The pointed object has to be deallocated manually
@@ -243,6 +341,43 @@ public:
      */
     virtual void dropOwnedPointer(matvar_t* previouslyOwnedPointer) = 0;
 
+    /**
+     * @brief Give up the matvar_t pointer, if no other handler shares its ownership.
+     *
+     * All the handlers that were referring to the pointer, or to parts of it, become invalid.
+     * @return The pointer, which has to be deleted by the caller with DeleteMode::Delete.
+     * It is null if the pointer cannot be released, e.g. if the ownership is shared, or if the pointer does not own its data.
+     */
+    virtual matvar_t* releaseMatvar() = 0;
+
+    /**
+     * @brief Get the position of a field of the struct pointed by the handler
+     *
+     * Structs with many fields are searched through an index of the field names. The index is built at the first lookup
+     * and it is shared by all the handlers with the same ownership.
+     * @param field The name of the field
+     * @param index The position of the field, or the number of fields if not found.
+     * @return True if the field has been found.
+     */
+    bool getStructFieldIndex(const std::string& field, size_t& index) const;
+
+    /**
+     * @brief Discard the index of the fields of the struct pointed by the handler. It has to be called after adding a field.
+     */
+    void invalidateStructFieldIndex() const;
+
+    /**
+     * @brief Change the size of the data buffer of the pointer, preserving its content
+     *
+     * The dimensions of the pointer are not changed, while its nbytes field is set to the new size of the buffer.
+     * This allows keeping spare capacity after the elements, since matio uses the dimensions when writing the variable.
+     * If the buffer is moved, the generation is incremented.
+     * @param bytes The new size of the buffer in bytes.
+     * @return True if successful, false if the handler is not sharing the ownership of the pointer,
+     * if the pointer does not own its data (e.g. if it is borrowed), if the pointer is complex or sparse, or if the allocation failed.
+     */
+    bool reallocateData(size_t bytes);
+
     /**
      * @brief Get the value type of the pointer
      * @return The value type of the pointer
@@ -269,6 +404,19 @@ public:
      */
     static void DeleteMatvar(matvar_t* pointerToDelete, DeleteMode mode = DeleteMode::Delete);
 
+    /**
+     * @brief Get the counter of the changes to the matvar_t pointers sharing the ownership of this handler
+     *
+     * The counter is incremented every time a matvar_t of the same ownership (i.e. of the same variable, its fields and its elements)
+     * is replaced, dropped or deleted. Objects caching the data pointer of a matvar_t can store the value of the counter,
+     * and refresh the cache only when it changes. Changes to unrelated variables do not affect it.
+     * @return A pointer to the counter, whose value is never zero. It is null if the handler does not refer to any ownership.
+     */
+    const std::atomic<uint64_t>* generation() const
+    {
+        return m_generation.get();
+    }
+
 };
 
 
@@ -12,6 +12,7 @@
 #include <matioCpp/ConversionUtilities.h>
 #include <matioCpp/Span.h>
 #include <matioCpp/Variable.h>
+#include <matioCpp/MultiIndex.h>
 
 /**
  * @brief MultiDimensionalArray is a particular type of Variable specialized for multidimensional arrays of a generic type T.
@@ -75,6 +76,28 @@ public:
      */
     MultiDimensionalArray(const std::string& name, const std::vector<index_type>& dimensions, const_pointer inputVector);
 
+    /**
+     * @brief Constructor
+     * @param name The name of the MultiDimensionalArray
+     * @param dimensions The dimensions of the MultiDimensionalArray
+     * @param inputVector The raw pointer to the data stored in column-major order
+     * @param dataOwnership Specifies if the input data is copied or borrowed.
+     * @warning When the data is borrowed, the MultiDimensionalArray points directly to inputVector, without copying it.
+     * The input memory is never deallocated by the MultiDimensionalArray and it has to outlive it, together with all the variables sharing its content.
+     * Operations changing the dimensions of the MultiDimensionalArray make it allocate new memory.
+     */
+    MultiDimensionalArray(const std::string& name, const std::vector<index_type>& dimensions, pointer inputVector, matioCpp::DataOwnership dataOwnership);
+
+    /**
+     * @brief Constructor
+     * @param name The name of the MultiDimensionalArray
+     * @param dimensions The dimensions of the MultiDimensionalArray
+     * @param inputVector The input data stored in column-major order. Its storage is adopted by the MultiDimensionalArray without copying the data.
+     * @note The adopted storage is released when the MultiDimensionalArray, and all the variables sharing its content, are deallocated.
+     * @warning The size of inputVector has to be equal to the product of the dimensions.
+     */
+    MultiDimensionalArray(const std::string& name, const std::vector<index_type>& dimensions, std::vector<element_type>&& inputVector);
+
     /**
      * @brief Copy constructor
      */
@@ -134,6 +157,16 @@ public:
      */
     index_type rawIndexFromIndices(const std::vector<index_type>& el) const;
 
+    /**
+     * @brief Get the index in the vectorized array corresponding to the provided indices
+     * @param el The desired element. The number of indices has to be equal to the number of dimensions.
+     * @warning It checks if the element is in the bounds only in debug mode.
+     * @note Differently from the version taking a std::vector, it does not allocate memory.
+     * @return the index in the vectorized array corresponding to the provided indices
+     */
+    template<size_t N>
+    index_type rawIndexFromIndices(const std::array<index_type, N>& el) const;
+
     /**
      * @brief Get the indices given the raw index
      * @param rawIndex The input raw index from which to compute the indices
@@ -143,6 +176,15 @@ public:
      */
     bool indicesFromRawIndex(size_t rawIndex, std::vector<index_type>& el) const;
 
+    /**
+     * @brief Get the indices of all the elements, to be iterated in column-major order
+     *
+     * The indices are updated incrementally while iterating. Each MultiIndex also provides the raw index,
+     * hence it can be used to access the elements without computing their position again.
+     * @return The range of indices.
+     */
+    matioCpp::MultiIndexRange indices() const;
+
     /**
      * @brief Get this MultiDimensionalArray as a Span
      */
@@ -252,6 +294,92 @@ public:
      * @return A copy to the element.
      */
     value_type operator[](index_type el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param i0 The index along the first dimension.
+     * @param i1 The index along the second dimension.
+     * @param others The indices along the other dimensions.
+     * @warning The number of indices has to be equal to the number of dimensions. Each index has to be strictly smaller than the corresponding dimension.
+     * @return A reference to the element.
+     */
+    template<typename... Indices>
+    reference operator()(index_type i0, index_type i1, Indices... others);
+
+    /**
+     * @brief Access specified element.
+     * @param i0 The index along the first dimension.
+     * @param i1 The index along the second dimension.
+     * @param others The indices along the other dimensions.
+     * @warning The number of indices has to be equal to the number of dimensions. Each index has to be strictly smaller than the corresponding dimension.
+     * @return A copy to the element.
+     */
+    template<typename... Indices>
+    value_type operator()(index_type i0, index_type i1, Indices... others) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A reference to the element.
+     */
+    template<size_t N>
+    reference operator()(const std::array<index_type, N>& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A copy to the element.
+     */
+    template<size_t N>
+    value_type operator()(const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A reference to the element.
+     */
+    template<size_t N>
+    reference operator[](const std::array<index_type, N>& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A copy to the element.
+     */
+    template<size_t N>
+    value_type operator[](const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A reference to the element.
+     */
+    reference operator()(const matioCpp::MultiIndex& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A copy to the element.
+     */
+    value_type operator()(const matioCpp::MultiIndex& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A reference to the element.
+     */
+    reference operator[](const matioCpp::MultiIndex& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A copy to the element.
+     */
+    value_type operator[](const matioCpp::MultiIndex& el) const;
 };
 
 #include "impl/MultiDimensionalArray.tpp"
@@ -0,0 +1,193 @@
+#ifndef MATIOCPP_MULTIINDEX_H
+#define MATIOCPP_MULTIINDEX_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/ForwardDeclarations.h>
+#include <matioCpp/Span.h>
+
+/**
+ * @brief The indices of an element of a multidimensional array, together with its raw index in the column-major data.
+ *
+ * It is obtained by iterating over a MultiIndexRange, and it can be used to access the elements of MultiDimensionalArray,
+ * CellArray and StructArray without computing the raw index again.
+ */
+class matioCpp::MultiIndex
+{
+    std::vector<size_t> m_indices; /** The index along each dimension. **/
+
+    size_t m_rawIndex{0}; /** The position of the element in the column-major data. **/
+
+    friend class matioCpp::MultiIndexIterator;
+
+public:
+
+    /**
+     * @brief Default constructor. It refers to the first element of an array without dimensions.
+     */
+    MultiIndex() = default;
+
+    /**
+     * @brief Get the index along each dimension
+     * @return The indices of the element.
+     */
+    const std::vector<size_t>& indices() const;
+
+    /**
+     * @brief Get the raw index
+     * @return The position of the element in the column-major data.
+     */
+    size_t rawIndex() const;
+
+    /**
+     * @brief Get the number of dimensions
+     * @return The number of indices.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the index along a dimension
+     * @param dimension The dimension.
+     * @return The index along the specified dimension.
+     */
+    size_t operator[](size_t dimension) const;
+
+    /**
+     * @brief Get the raw index of an element of a column-major array, given its indices
+     *
+     * Differently from the rawIndexFromIndices methods taking a std::vector, the number of indices is known at compile time,
+     * hence the computation does not allocate memory and it can be unrolled by the compiler.
+     * @param dimensions The dimensions of the array. Its size has to be equal to N.
+     * @param el The indices of the element.
+     * @warning It checks if the element is in the bounds only in debug mode.
+     * @return The raw index of the element.
+     */
+    template<size_t N>
+    static size_t RawIndexFromIndices(matioCpp::Span<const size_t> dimensions, const std::array<size_t, N>& el);
+};
+
+/**
+ * @brief Forward iterator over the indices of all the elements of a multidimensional array, in column-major order.
+ *
+ * The indices are updated incrementally, avoiding the divisions needed to compute them from the raw index.
+ */
+class matioCpp::MultiIndexIterator
+{
+    std::vector<size_t> m_dimensions; /** The dimensions of the array. **/
+
+    matioCpp::MultiIndex m_index; /** The current element. **/
+
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+
+    using value_type = matioCpp::MultiIndex;
+
+    using difference_type = std::ptrdiff_t;
+
+    using pointer = const matioCpp::MultiIndex*;
+
+    using reference = const matioCpp::MultiIndex&;
+
+    /**
+     * @brief Default constructor.
+     */
+    MultiIndexIterator() = default;
+
+    /**
+     * @brief Constructor
+     * @param dimensions The dimensions of the array.
+     * @param rawIndex The raw index of the first element to be pointed. If it is not smaller than the number of elements, the iterator points to the end.
+     */
+    MultiIndexIterator(matioCpp::Span<const size_t> dimensions, size_t rawIndex);
+
+    /**
+     * @brief Access the current element
+     * @return The current indices.
+     */
+    reference operator*() const;
+
+    /**
+     * @brief Access the current element
+     * @return A pointer to the current indices.
+     */
+    pointer operator->() const;
+
+    /**
+     * @brief Move to the next element
+     * @return A reference to this iterator.
+     */
+    MultiIndexIterator& operator++();
+
+    /**
+     * @brief Move to the next element
+     * @return A copy of the iterator before the increment.
+     */
+    MultiIndexIterator operator++(int);
+
+    /**
+     * @brief Compare with another iterator
+     * @param other The other iterator, referring to the same array.
+     * @return True if they point to the same element.
+     */
+    bool operator==(const MultiIndexIterator& other) const;
+
+    /**
+     * @brief Compare with another iterator
+     * @param other The other iterator, referring to the same array.
+     * @return True if they point to different elements.
+     */
+    bool operator!=(const MultiIndexIterator& other) const;
+};
+
+/**
+ * @brief The indices of all the elements of a multidimensional array, to be used in a range-based for loop.
+ *
+ * It stores a copy of the dimensions, hence it is not affected by later changes of the array.
+ */
+class matioCpp::MultiIndexRange
+{
+    std::vector<size_t> m_dimensions; /** The dimensions of the array. **/
+
+    size_t m_numberOfElements{0}; /** The number of elements of the array. **/
+
+public:
+
+    /**
+     * @brief Default constructor. The range is empty.
+     */
+    MultiIndexRange() = default;
+
+    /**
+     * @brief Constructor
+     * @param dimensions The dimensions of the array.
+     */
+    MultiIndexRange(matioCpp::Span<const size_t> dimensions);
+
+    /**
+     * @brief Get the number of elements
+     * @return The number of elements in the range.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get an iterator to the first element
+     * @return An iterator to the first element.
+     */
+    matioCpp::MultiIndexIterator begin() const;
+
+    /**
+     * @brief Get an iterator past the last element
+     * @return An iterator past the last element.
+     */
+    matioCpp::MultiIndexIterator end() const;
+};
+
+#include "impl/MultiIndex.tpp"
+
+#endif // MATIOCPP_MULTIINDEX_H
@@ -20,6 +20,12 @@ class matioCpp::SharedMatvar : public matioCpp::MatvarHandler
      */
     std::shared_ptr<MatvarHandler::Ownership> m_ownership;
 
+    /**
+     * @brief Get the ownership object
+     * @return A pointer to the ownership object.
+     */
+    virtual std::shared_ptr<MatvarHandler::Ownership> lockOwnership() const final;
+
 public:
 
     /**
@@ -44,8 +50,10 @@ public:
     /**
      * @brief Import an existing matvar_t and take control of it (it will be deallocated when no other SharedMatvar objects point to it).
      * @param inputPtr The input pointer to control.
+     * @param deleteMode The mode with which the pointer has to be deleted
+     * @param dataOwner Optional object owning the data of inputPtr. It is kept alive until inputPtr is deleted.
      */
-    SharedMatvar(matvar_t* inputPtr);
+    SharedMatvar(matvar_t* inputPtr, matioCpp::DeleteMode deleteMode = matioCpp::DeleteMode::Delete, std::shared_ptr<void> dataOwner = nullptr);
 
     /**
      * @brief Destructor
@@ -70,7 +78,7 @@ public:
     /**
      * Docs inherited
      */
-    virtual bool importMatvar(matvar_t *inputPtr) final;
+    virtual bool importMatvar(matvar_t *inputPtr, matioCpp::DeleteMode deleteMode = matioCpp::DeleteMode::Delete, std::shared_ptr<void> dataOwner = nullptr) final;
 
     /**
      * Docs inherited
@@ -87,6 +95,11 @@ public:
      */
     virtual void dropOwnedPointer(matvar_t* previouslyOwnedPointer) final;
 
+    /**
+     * Docs inherited
+     */
+    virtual matvar_t* releaseMatvar() final;
+
     /**
      * @brief Copy assignement
      * @param other The other object to copy.
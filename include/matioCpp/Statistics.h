@@ -0,0 +1,155 @@
+#ifndef MATIOCPP_STATISTICS_H
+#define MATIOCPP_STATISTICS_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/ForwardDeclarations.h>
+#include <matioCpp/Config.h>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Counters and timers of the most expensive operations performed by the library.
+ *
+ * The statistics are collected only if the library has been compiled with the MATIOCPP_ENABLE_STATISTICS option.
+ * Otherwise, the instrumentation is compiled out and the snapshot is always empty.
+ * The counters are global and can be updated concurrently from different threads.
+ */
+class matioCpp::Statistics
+{
+public:
+
+    /**
+     * @brief The class of operations being measured.
+     */
+    enum class Operation
+    {
+        FileRead, /** Reading a variable from a file, including the decompression. **/
+        FileWrite, /** Writing a variable to a file without compression. **/
+        FileWriteCompressed, /** Writing a variable to a file with compression. **/
+        VariableInitialization, /** Creation of the matvar_t of a variable, including the copy of the input data. **/
+        DeepCopy /** Deep copy of a matvar_t through MatvarHandler::GetMatvarDuplicate. **/
+    };
+
+    static constexpr size_t NumberOfOperations = 5; /** The number of elements in Operation. **/
+
+    /**
+     * @brief The statistics of a class of operations.
+     */
+    struct Counters
+    {
+        uint64_t count{0}; /** Number of successful operations. **/
+        uint64_t bytes{0}; /** Bytes of data read, written, or copied. **/
+        uint64_t nodes{0}; /** Number of matvar_t involved, including the fields and the elements of cell arrays. **/
+        uint64_t nanoseconds{0}; /** Cumulative duration of the operations. **/
+    };
+
+    /**
+     * @brief A copy of the statistics at a given time.
+     */
+    class Snapshot
+    {
+        Counters m_counters[NumberOfOperations];
+
+        friend class matioCpp::Statistics;
+
+    public:
+
+        /**
+         * @brief Get the statistics of a class of operations
+         * @param operation The operation of interest
+         * @return The counters of the operation.
+         */
+        const Counters& operator[](Operation operation) const;
+    };
+
+    /**
+     * @brief Measures an operation from its construction to its destruction.
+     *
+     * The operation is recorded only if addVariable or addData have been called, i.e. if it has been successful.
+     * Nested operations of the same class on the same thread are recorded only once, by the outermost one.
+     * If the library has been compiled with the MATIOCPP_ENABLE_TRACING option, the operation is also
+     * recorded as a Tracing event, even if it failed.
+     */
+    class ScopedOperation
+    {
+#if defined(MATIOCPP_ENABLE_STATISTICS) || defined(MATIOCPP_ENABLE_TRACING)
+        Operation m_operation;
+        bool m_outermost;
+        bool m_completed{false};
+        uint64_t m_bytes{0};
+        uint64_t m_nodes{0};
+        const char* m_variableName{nullptr};
+        std::chrono::steady_clock::time_point m_start;
+
+    public:
+
+        explicit ScopedOperation(Operation operation);
+
+        ~ScopedOperation();
+
+        /**
+         * @brief Record the data and the number of nodes of a variable
+         * @param variable The variable processed by the operation.
+         */
+        void addVariable(const matvar_t* variable);
+
+        /**
+         * @brief Record the processed data
+         * @param bytes The number of bytes.
+         * @param nodes The number of matvar_t.
+         */
+        void addData(size_t bytes, size_t nodes);
+#else
+    public:
+
+        explicit ScopedOperation(Operation) {}
+
+        void addVariable(const matvar_t*) {}
+
+        void addData(size_t, size_t) {}
+#endif
+
+        ScopedOperation(const ScopedOperation& other) = delete;
+
+        ScopedOperation& operator=(const ScopedOperation& other) = delete;
+    };
+
+    /**
+     * @brief Check if the statistics are collected
+     * @return True if the library has been compiled with the MATIOCPP_ENABLE_STATISTICS option.
+     */
+    static constexpr bool isEnabled()
+    {
+#ifdef MATIOCPP_ENABLE_STATISTICS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Get a copy of the current statistics
+     * @return The current value of the counters.
+     */
+    static Snapshot snapshot();
+
+    /**
+     * @brief Set all the counters to zero
+     */
+    static void reset();
+
+    /**
+     * @brief Get the name of an operation, for example to export the statistics
+     * @param operation The operation
+     * @return The name of the operation.
+     */
+    static std::string operationName(Operation operation);
+};
+
+#endif // MATIOCPP_STATISTICS_H
@@ -0,0 +1,282 @@
+#ifndef MATIOCPP_STRIDEDVIEW_H
+#define MATIOCPP_STRIDEDVIEW_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/ForwardDeclarations.h>
+#include <matioCpp/ConversionUtilities.h>
+#include <matioCpp/Span.h>
+#include <matioCpp/MultiDimensionalArray.h>
+#include <matioCpp/MultiIndex.h>
+
+/**
+ * @brief The elements selected along one dimension of a StridedView.
+ *
+ * The selected indices are start, start + step, start + 2 * step, ... up to stop, excluded.
+ */
+class matioCpp::Slice
+{
+    size_t m_start{0}; /** The first selected index. **/
+
+    size_t m_stop{matioCpp::Slice::End}; /** The selection stops before this index. **/
+
+    size_t m_step{1}; /** The distance between two selected indices. **/
+
+public:
+
+    static constexpr size_t End = std::numeric_limits<size_t>::max(); /** Used as stop to select up to the end of the dimension. **/
+
+    /**
+     * @brief Default constructor. All the elements along the dimension are selected.
+     */
+    Slice() = default;
+
+    /**
+     * @brief Constructor selecting a single index
+     * @param index The selected index.
+     */
+    Slice(size_t index);
+
+    /**
+     * @brief Constructor
+     * @param start The first selected index.
+     * @param stop The selection stops before this index. Use matioCpp::Slice::End to select up to the end of the dimension.
+     * @param step The distance between two selected indices. It has to be greater than zero.
+     */
+    Slice(size_t start, size_t stop, size_t step = 1);
+
+    /**
+     * @brief Select all the elements along a dimension
+     * @return A Slice selecting all the elements.
+     */
+    static Slice All();
+
+    /**
+     * @brief Get the first selected index
+     * @return The first selected index.
+     */
+    size_t start() const;
+
+    /**
+     * @brief Get the index before which the selection stops
+     * @return The stop index, or matioCpp::Slice::End.
+     */
+    size_t stop() const;
+
+    /**
+     * @brief Get the distance between two selected indices
+     * @return The step.
+     */
+    size_t step() const;
+};
+
+/**
+ * @brief StridedView is a non-owning view of a strided subset of the elements of a MultiDimensionalArray, with any number of dimensions.
+ *
+ * The subset is specified by a Slice for each dimension of the array. The view has the same number of dimensions of the array,
+ * as in Matlab, where selecting a single index along a dimension keeps that dimension with size 1.
+ * The slices are validated once, when the view is created, and no Eigen dependency is needed.
+ * Use copyTo to extract the selected elements in a contiguous buffer.
+ * Use a const type T, e.g. StridedView<const double>, to obtain a read-only view.
+ * @warning The view points directly to the data of the array. It does not keep the array alive, and it becomes dangling
+ * if the array is deallocated, resized or reassigned.
+ */
+template<typename T>
+class matioCpp::StridedView
+{
+public:
+
+    using type = T; /** Defines the type specified in the template. **/
+
+    using value_type = std::remove_cv_t<T>; /** Defines the type T without "const". **/
+
+    using element_type = std::conditional_t<std::is_const<T>::value,
+                                            const typename get_type<value_type>::type,
+                                            typename get_type<value_type>::type>; /** Defines the type of an element of the view. **/
+
+    using index_type = size_t; /** The type used for indices. **/
+
+    using reference = element_type&; /** The reference type. **/
+
+    using pointer = element_type*; /** The pointer type. **/
+
+private:
+
+    pointer m_data{nullptr}; /** The first selected element. **/
+
+    std::vector<index_type> m_dimensions; /** The number of selected elements along each dimension. **/
+
+    std::vector<index_type> m_strides; /** The distance in the data of the array between two consecutive selected elements along each dimension. **/
+
+    std::vector<index_type> m_loopDimensions; /** The dimensions used by copyTo, where the singleton dimensions are removed and the contiguous ones are merged. **/
+
+    std::vector<index_type> m_loopStrides; /** The strides corresponding to m_loopDimensions. **/
+
+    index_type m_numberOfElements{0}; /** The total number of selected elements. **/
+
+    bool m_valid{false}; /** True if the view has been initialized successfully. **/
+
+    /**
+     * @brief Initialize the view
+     * @param data The data of the array.
+     * @param dimensions The dimensions of the array.
+     * @param slices The slices along each dimension.
+     * @return True if the slices are compatible with the dimensions.
+     */
+    bool initialize(pointer data, matioCpp::Span<const size_t> dimensions, const std::vector<matioCpp::Slice>& slices);
+
+    /**
+     * @brief Copy the selected elements
+     * @param output The destination of the copy. It has to contain numberOfElements() elements.
+     */
+    void copyElements(typename get_type<value_type>::type* output) const;
+
+public:
+
+    /**
+     * @brief Default constructor. The view is not valid.
+     */
+    StridedView();
+
+    /**
+     * @brief Constructor
+     * @param array The array to view.
+     * @param slices The slices along each dimension. Their number cannot exceed the number of dimensions of the array.
+     * If they are fewer, all the elements are selected along the remaining dimensions.
+     * If the slices are not compatible with the array, an error is printed and the view is not valid.
+     */
+    StridedView(matioCpp::MultiDimensionalArray<value_type>& array, const std::vector<matioCpp::Slice>& slices);
+
+    /**
+     * @brief Constructor from a const MultiDimensionalArray. Available only for const types.
+     * @param array The array to view.
+     * @param slices The slices along each dimension. Their number cannot exceed the number of dimensions of the array.
+     */
+    template<typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+    StridedView(const matioCpp::MultiDimensionalArray<value_type>& array, const std::vector<matioCpp::Slice>& slices);
+
+    /**
+     * @brief Check if the view has been created successfully
+     * @return True if the view refers to the data of an array.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Get the number of dimensions
+     * @return The number of dimensions, equal to the one of the viewed array.
+     */
+    size_t rank() const;
+
+    /**
+     * @brief Get the dimensions
+     * @return The number of selected elements along each dimension.
+     */
+    const std::vector<index_type>& dimensions() const;
+
+    /**
+     * @brief Get the strides
+     * @return The distance, in number of elements of the viewed array, between two consecutive selected elements along each dimension.
+     */
+    const std::vector<index_type>& strides() const;
+
+    /**
+     * @brief Get the total number of selected elements
+     * @return The total number of selected elements.
+     */
+    index_type numberOfElements() const;
+
+    /**
+     * @brief Direct access to the underlying data.
+     * @return A pointer to the first selected element.
+     */
+    pointer data() const;
+
+    /**
+     * @brief Get the indices of all the selected elements, in column-major order
+     * @return A range to be used in a range-based for loop.
+     */
+    matioCpp::MultiIndexRange indices() const;
+
+    /**
+     * @brief Get the position of an element with respect to data(), given its indices in the view
+     * @param el The desired element
+     * @warning It checks if the element is in the bounds only in debug mode.
+     * @return The distance of the element from data().
+     */
+    index_type rawIndexFromIndices(const std::vector<index_type>& el) const;
+
+    /**
+     * @brief Get the position of an element with respect to data(), given its indices in the view
+     * @param el The desired element. N has to be equal to the rank.
+     * @warning It checks if the element is in the bounds only in debug mode.
+     * @return The distance of the element from data().
+     */
+    template<size_t N>
+    index_type rawIndexFromIndices(const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param i0 The index along the first dimension.
+     * @param others The indices along the other dimensions. Their number has to be equal to the rank minus one.
+     * @warning Each index has to be strictly smaller than the corresponding dimension. This is checked only in debug mode.
+     * @return A reference to the element.
+     */
+    template<typename... Indices>
+    reference operator()(index_type i0, Indices... others) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension. This is checked only in debug mode.
+     * @return A reference to the element.
+     */
+    reference operator()(const std::vector<index_type>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from the indices() method of the view.
+     * @return A reference to the element.
+     */
+    reference operator()(const matioCpp::MultiIndex& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension. This is checked only in debug mode.
+     * @return A reference to the element.
+     */
+    reference operator[](const std::vector<index_type>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from the indices() method of the view.
+     * @return A reference to the element.
+     */
+    reference operator[](const matioCpp::MultiIndex& el) const;
+
+    /**
+     * @brief Copy the selected elements in a contiguous buffer, in column-major order
+     *
+     * The dimensions that are contiguous in the viewed array are merged, and the contiguous runs are copied at once.
+     * @param output The destination. Its size has to be equal to numberOfElements().
+     * @return True if successful, false otherwise, printing an error.
+     */
+    bool copyTo(matioCpp::Span<typename get_type<value_type>::type> output) const;
+
+    /**
+     * @brief Copy the selected elements in a MultiDimensionalArray
+     * @param output The destination. It is resized to the dimensions of the view, if needed.
+     * @return True if successful, false otherwise, printing an error. It fails if the output cannot be resized,
+     * for example when it is a field of a struct.
+     */
+    bool copyTo(matioCpp::MultiDimensionalArray<value_type>& output) const;
+};
+
+#include "impl/StridedView.tpp"
+
+#endif // MATIOCPP_STRIDEDVIEW_H
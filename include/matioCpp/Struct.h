@@ -51,6 +51,15 @@ public:
      */
     Struct(const std::string& name, const std::vector<Variable> &elements);
 
+    /**
+     * @brief Constructor
+     * @param name The name of the Struct
+     * @param elements The elements to be moved in the Struct.
+     * An element is moved only if it is the only owner of its data, i.e. if no other variable is sharing it.
+     * In this case, the element becomes invalid. Otherwise, it is copied and left untouched.
+     */
+    Struct(const std::string& name, std::vector<Variable> &&elements);
+
     /**
      * @brief Copy constructor
      */
@@ -122,13 +131,13 @@ public:
 
     /**
      * @brief Check if a field is existing
-     * It performs a linear search over the output of fields().
+     * Structs with many fields are searched through an index of the field names.
      * @return True if the field is existing, false otherwise.
      */
     bool isFieldExisting(const std::string& field) const;
 
     /**
-     * @brief Get the index of the specified field in the struct by performing a linear search
+     * @brief Get the index of the specified field in the struct
      * @param field The field to search
      * @return The index of the field, the output of numberOfFields() if not found.
      */
@@ -149,7 +158,7 @@ public:
      * @param newValue The Variable that will be copied in the specified field
      * @return True if successful, false otherwise (for example if the newValue is not valid)
      * @note If the field is not found, a new field is created and appended to the struct.
-     * @note The field is searched linearly. The name of newValue is not used
+     * @note The name of newValue is not used
      */
     bool setField(const std::string& field, const Variable& newValue);
 
@@ -161,6 +170,49 @@ public:
      */
     bool setField(const Variable& newValue);
 
+    /**
+     * @brief Set the field at the specified position
+     * @param index The linear index of the specified field
+     * @param newValue The Variable that will be moved in the specified location.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True if successful, false otherwise (for example if the newValue is not valid)
+     * @note An assertion is thrown if index is out of bounds, but only in debug mode
+     */
+    bool setField(index_type index, Variable&& newValue);
+
+    /**
+     * @brief Set the given field to the newValue
+     * @param field The name of the field to set
+     * @param newValue The Variable that will be moved in the specified field.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True if successful, false otherwise (for example if the newValue is not valid)
+     * @note If the field is not found, a new field is created and appended to the struct.
+     * @note The name of newValue is not used
+     */
+    bool setField(const std::string& field, Variable&& newValue);
+
+    /**
+     * @brief Set the field given the newValue name
+     * @param newValue The Variable that will be moved in the specified field.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True if successful, false otherwise (for example if the newValue is not valid)
+     * @note If the field is not found, a new field is created and appended to the struct.
+     */
+    bool setField(Variable&& newValue);
+
+    /**
+     * @brief Set many fields at once, given the names of the new values
+     *
+     * The fields that are not found are appended to the struct, in the order of newValues.
+     * The new table of fields is built at once, instead of adding the fields one by one.
+     * @param newValues The Variables that will be moved in the corresponding fields.
+     * A Variable is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True if successful, false otherwise (for example if one of newValues is not valid, or if two of them have the same name).
+     * In case of failure, the struct and newValues are not modified.
+     * @note All the variables referring to the previous fields of the struct become invalid.
+     */
+    bool setFields(std::vector<Variable>&& newValues);
+
     /**
      * @brief Access field at a specific index.
      * @param el The index of the field to be accessed.
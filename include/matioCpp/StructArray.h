@@ -10,8 +10,10 @@
 
 #include <matioCpp/ForwardDeclarations.h>
 #include <matioCpp/Variable.h>
+#include <matioCpp/MultiIndex.h>
 #include <matioCpp/Struct.h>
 #include <matioCpp/StructArrayElement.h>
+#include <matioCpp/FieldHandle.h>
 
 /**
  * @brief StructArray is a particular type of Variable specialized for array of structs.
@@ -29,6 +31,44 @@ class matioCpp::StructArray : public matioCpp::Variable
      */
     virtual bool checkCompatibility(const matvar_t* inputPtr, matioCpp::VariableType variableType, matioCpp::ValueType valueType) const final;
 
+    /**
+     * @brief Check if a vector of Structs can be used to fill a StructArray.
+     *
+     * The set of fields of each element is compared to the one of the first element through a signature of the field names,
+     * hence the names are read only once per element.
+     * @param dimensions The dimensions of the StructArray
+     * @param elements The elements to check.
+     * @param caller The name of the calling method, used in the error messages.
+     * @return True if the number of elements matches the dimensions, and all the elements are valid and have the same set of fields.
+     */
+    bool checkVectorOfStructs(const std::vector<size_t>& dimensions, const std::vector<matioCpp::Struct>& elements, const std::string& caller) const;
+
+    /**
+     * @brief Check if a Struct has the same fields of the array, in the same order.
+     * @param newValue The Struct to check.
+     * @param caller The name of the calling method, used in the error messages.
+     * @return True if newValue is valid and it has the same fields of the array.
+     */
+    bool checkElementFields(const matioCpp::Struct& newValue, const std::string& caller) const;
+
+    /**
+     * @brief Check if some Structs can be added to the array.
+     *
+     * If the array has no elements and no fields, the fields of the first Struct are added to the array.
+     * @param newValues The Structs to add.
+     * @param caller The name of the calling method, used in the error messages.
+     * @return True if all the Structs have the same fields of the array.
+     */
+    bool prepareNewElements(matioCpp::Span<const matioCpp::Struct> newValues, const std::string& caller);
+
+    /**
+     * @brief Move the fields of a Struct in an element of the array whose fields are empty.
+     * @param el The linear index of the element.
+     * @param newValue The Struct to move. Its fields are copied if it is not the only owner of its data.
+     * @return True if successful.
+     */
+    bool moveInEmptyElement(size_t el, matioCpp::Struct&& newValue);
+
     template<bool>
     friend class StructArrayElement;
 
@@ -72,6 +112,22 @@ public:
                 const std::vector<index_type>& dimensions,
                 const std::vector<matioCpp::Struct>& elements);
 
+    /**
+     * @brief Constructor
+     * @param name The name of the StructArray
+     * @param dimensions The dimensions of the StructArray
+     * @param elements The elements to be moved in the StructArray
+     * @note The fields of an element are moved only if the element is the only owner of its data,
+     * i.e. if no other variable is sharing it. In this case, the element becomes invalid.
+     * Otherwise, the fields are copied and the element is left untouched.
+     * @note The name of the variables is not used
+     * @note The vector is supposed to contain the variables in column-major format.
+     * @note Each element is supposed to have the same set of fields.
+     */
+    StructArray(const std::string& name,
+                const std::vector<index_type>& dimensions,
+                std::vector<matioCpp::Struct>&& elements);
+
     /**
      * @brief Constructor
      * @param name The name of the StructArray
@@ -142,6 +198,16 @@ public:
      */
     index_type rawIndexFromIndices(const std::vector<index_type>& el) const;
 
+    /**
+     * @brief Get the index in the vectorized array corresponding to the provided indices
+     * @param el The desired element. The number of indices has to be equal to the number of dimensions.
+     * @warning It checks if the element is in the bounds only in debug mode.
+     * @note Differently from the version taking a std::vector, it does not allocate memory.
+     * @return the index in the vectorized array corresponding to the provided indices
+     */
+    template<size_t N>
+    index_type rawIndexFromIndices(const std::array<index_type, N>& el) const;
+
     /**
      * @brief Get the indices given the raw index
      * @param rawIndex The input raw index from which to compute the indices
@@ -151,6 +217,15 @@ public:
      */
     bool indicesFromRawIndex(size_t rawIndex, std::vector<index_type>& el) const;
 
+    /**
+     * @brief Get the indices of all the elements, to be iterated in column-major order
+     *
+     * The indices are updated incrementally while iterating. Each MultiIndex also provides the raw index,
+     * hence it can be used to access the elements without computing their position again.
+     * @return The range of indices.
+     */
+    matioCpp::MultiIndexRange indices() const;
+
     /**
      * @brief Change the name of the Variable
      * @param newName The new name
@@ -160,12 +235,56 @@ public:
 
     /**
      * @brief Resize the array.
-     * @param newDimensions The new dimensions.
      *
-     * @warning Previous data is lost.
+     * The elements whose indices are within the new dimensions are kept, without copying them. The other elements are deleted.
+     * The fields of the new elements are empty.
+     * @param newDimensions The new dimensions.
      */
     void resize(const std::vector<index_type>& newDimensions);
 
+    /**
+     * @brief Add an element at the end of the array
+     *
+     * The array needs to have a single row or a single column. The amortized cost does not depend on the number of elements.
+     * @param newValue The Struct that will be copied at the end of the array. It needs to have the same fields of the array.
+     * If the array has no elements and no fields, the fields of newValue are added to the array.
+     * @return True if successful, false otherwise, for example if the fields do not match.
+     */
+    bool push_back(const matioCpp::Struct& newValue);
+
+    /**
+     * @brief Add an element at the end of the array
+     *
+     * The array needs to have a single row or a single column. The amortized cost does not depend on the number of elements.
+     * @param newValue The Struct whose fields will be moved at the end of the array. It needs to have the same fields of the array.
+     * If the array has no elements and no fields, the fields of newValue are added to the array.
+     * The fields are moved only if newValue is the only owner of its data, i.e. if no other variable is sharing it. In this case, it becomes invalid.
+     * Otherwise, they are copied.
+     * @return True if successful, false otherwise, for example if the fields do not match.
+     */
+    bool push_back(matioCpp::Struct&& newValue);
+
+    /**
+     * @brief Add elements at the end of the array
+     *
+     * The array needs to have a single row or a single column.
+     * @param newValues The Structs that will be copied at the end of the array. They need to have the same fields of the array.
+     * If the array has no elements and no fields, the fields of the first Struct are added to the array.
+     * @return True if successful, false otherwise, for example if the fields do not match. In this case, no element is added.
+     */
+    bool append(const std::vector<matioCpp::Struct>& newValues);
+
+    /**
+     * @brief Add elements at the end of the array
+     *
+     * The array needs to have a single row or a single column.
+     * @param newValues The Structs whose fields will be moved at the end of the array. They need to have the same fields of the array.
+     * If the array has no elements and no fields, the fields of the first Struct are added to the array.
+     * The fields of a Struct are moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, they are copied.
+     * @return True if successful, false otherwise, for example if the fields do not match. In this case, no element is added.
+     */
+    bool append(std::vector<matioCpp::Struct>&& newValues);
+
     /**
      * @brief Get the total number of elements in the array
      * @return The total number of elements
@@ -191,18 +310,26 @@ public:
 
     /**
      * @brief Check if a field is existing
-     * It performs a linear search over the output of fields().
+     * Structs with many fields are searched through an index of the field names.
      * @return True if the field is existing, false otherwise.
      */
     bool isFieldExisting(const std::string& field) const;
 
     /**
-     * @brief Get the index of the specified field in the struct by performing a linear search
+     * @brief Get the index of the specified field in the struct
      * @param field The field to search
      * @return The index of the field, the output of numberOfFields() if not found.
      */
     size_t getFieldIndex(const std::string& field) const;
 
+    /**
+     * @brief Resolve a field once, to access it in many elements without searching its name every time
+     * @param field The name of the field
+     * @return The handle of the field. It is not valid if the field does not exist.
+     * @note The handle is invalidated when adding fields, resizing or reassigning the array.
+     */
+    matioCpp::FieldHandle getFieldHandle(const std::string& field) const;
+
     /**
      * @brief Add a new field to all the structs
      * @param newField The new field
@@ -300,6 +427,99 @@ public:
      * @return A const Struct with a weak ownership to the underlying mat variable.
      */
     ConstElement operator[](index_type el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param i0 The index along the first dimension.
+     * @param i1 The index along the second dimension.
+     * @param others The indices along the other dimensions.
+     * @warning The number of indices has to be equal to the number of dimensions. Each index has to be strictly smaller than the corresponding dimension.
+     * @return A Struct with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the name cannot change, and no fields can be added.
+     */
+    template<typename... Indices>
+    Element operator()(index_type i0, index_type i1, Indices... others);
+
+    /**
+     * @brief Access specified element.
+     * @param i0 The index along the first dimension.
+     * @param i1 The index along the second dimension.
+     * @param others The indices along the other dimensions.
+     * @warning The number of indices has to be equal to the number of dimensions. Each index has to be strictly smaller than the corresponding dimension.
+     * @return A const Struct with a weak ownership to the underlying mat variable.
+     */
+    template<typename... Indices>
+    ConstElement operator()(index_type i0, index_type i1, Indices... others) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A Struct with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the name cannot change, and no fields can be added.
+     */
+    template<size_t N>
+    Element operator()(const std::array<index_type, N>& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A const Struct with a weak ownership to the underlying mat variable.
+     */
+    template<size_t N>
+    ConstElement operator()(const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A Struct with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the name cannot change, and no fields can be added.
+     */
+    template<size_t N>
+    Element operator[](const std::array<index_type, N>& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed.
+     * @warning Each element of el has to be strictly smaller than the corresponding dimension.
+     * @return A const Struct with a weak ownership to the underlying mat variable.
+     */
+    template<size_t N>
+    ConstElement operator[](const std::array<index_type, N>& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A Struct with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the name cannot change, and no fields can be added.
+     */
+    Element operator()(const matioCpp::MultiIndex& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A const Struct with a weak ownership to the underlying mat variable.
+     */
+    ConstElement operator()(const matioCpp::MultiIndex& el) const;
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A Struct with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the name cannot change, and no fields can be added.
+     */
+    Element operator[](const matioCpp::MultiIndex& el);
+
+    /**
+     * @brief Access specified element.
+     * @param el The element to be accessed, obtained from indices(). Its raw index is used directly.
+     * @return A const Struct with a weak ownership to the underlying mat variable.
+     */
+    ConstElement operator[](const matioCpp::MultiIndex& el) const;
 };
 
+#include "impl/StructArray.tpp"
+
 #endif // MATIOCPP_STRUCTARRAY_H
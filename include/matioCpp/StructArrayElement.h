@@ -11,6 +11,7 @@
 #include <matioCpp/ForwardDeclarations.h>
 #include <matioCpp/Variable.h>
 #include <matioCpp/Struct.h>
+#include <matioCpp/FieldHandle.h>
 
 template <bool isConst>
 class matioCpp::StructArrayElement
@@ -122,13 +123,13 @@ public:
 
     /**
      * @brief Check if a field is existing
-     * It performs a linear search over the output of fields().
+     * Structs with many fields are searched through an index of the field names.
      * @return True if the field is existing, false otherwise.
      */
     bool isFieldExisting(const std::string& field) const;
 
     /**
-     * @brief Get the index of the specified field in the struct by performing a linear search
+     * @brief Get the index of the specified field in the struct
      * @param field The field to search
      * @return The index of the field, the output of numberOfFields() if not found.
      */
@@ -162,6 +163,15 @@ public:
     template<bool B = isConst, typename = typename std::enable_if_t<(B == isConst) && !B>>
     bool setField(const Variable& newValue) const;
 
+    /**
+     * @brief Set the field given its handle
+     * @param field The handle of the field, obtained from the StructArray
+     * @param newValue The Variable that will be copied in the specified field (the name is not considered)
+     * @return True if successful, false otherwise (for example if the newValue or the handle are not valid)
+     */
+    template<bool B = isConst, typename = typename std::enable_if_t<(B == isConst) && !B>>
+    bool setField(const matioCpp::FieldHandle& field, const Variable& newValue) const;
+
     /**
      * @brief Get the element as a Struct.
      * @note This requires memory allocation. In particular, it needs to allocate a number of pointers equal to the number of fields
@@ -206,6 +216,24 @@ public:
      */
     output_variable_type operator[](const std::string& el) const;
 
+    /**
+     * @brief Access a field given its handle, without searching its name.
+     * @param field The handle of the field, obtained from the StructArray.
+     * @return A Variable with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the variable cannot be resized and the name cannot change.
+     * @note An assertion is thrown if the handle is not valid for the array, but only in debug mode
+     */
+    output_variable_type operator()(const matioCpp::FieldHandle& field) const;
+
+    /**
+     * @brief Access a field given its handle, without searching its name.
+     * @param field The handle of the field, obtained from the StructArray.
+     * @return A Variable with a weak ownership to the underlying mat variable. This means that the data can be changed,
+     * but the variable cannot be resized and the name cannot change.
+     * @note An assertion is thrown if the handle is not valid for the array, but only in debug mode
+     */
+    output_variable_type operator[](const matioCpp::FieldHandle& field) const;
+
 private:
 
     index_type m_innerIndex; /** The linear index in the array. **/
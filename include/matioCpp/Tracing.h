@@ -0,0 +1,135 @@
+#ifndef MATIOCPP_TRACING_H
+#define MATIOCPP_TRACING_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/ForwardDeclarations.h>
+#include <matioCpp/Config.h>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Timeline of the operations performed by the library, in the Chrome trace-event format.
+ *
+ * The events are collected only if the library has been compiled with the MATIOCPP_ENABLE_TRACING option,
+ * and only between a call to start() and a call to stop(). Each thread stores its events in its own
+ * preallocated buffer, without locks. When the buffer of a thread is full, the following events of that thread are dropped.
+ * The trace can be saved with writeChromeTrace and opened in chrome://tracing or https://ui.perfetto.dev.
+ */
+class matioCpp::Tracing
+{
+public:
+
+    using time_point = std::chrono::steady_clock::time_point;
+
+    /**
+     * @brief Records an event lasting from its construction to its destruction.
+     */
+    class ScopedEvent
+    {
+#ifdef MATIOCPP_ENABLE_TRACING
+        const char* m_name;
+        const char* m_detail{nullptr};
+        size_t m_bytes{0};
+        bool m_active;
+        time_point m_begin;
+
+    public:
+
+        /**
+         * @brief Constructor
+         * @param name The name of the event. It has to be a string literal.
+         */
+        explicit ScopedEvent(const char* name);
+
+        ~ScopedEvent();
+
+        /**
+         * @brief Add information to the event
+         * @param detail Text attached to the event, like the name of a variable. It has to remain valid until the destruction of the event.
+         * @param bytes The size of the processed data.
+         */
+        void setDetails(const char* detail, size_t bytes = 0);
+#else
+    public:
+
+        explicit ScopedEvent(const char*) {}
+
+        void setDetails(const char*, size_t = 0) {}
+#endif
+
+        ScopedEvent(const ScopedEvent& other) = delete;
+
+        ScopedEvent& operator=(const ScopedEvent& other) = delete;
+    };
+
+    /**
+     * @brief Check if the tracing is available
+     * @return True if the library has been compiled with the MATIOCPP_ENABLE_TRACING option.
+     */
+    static constexpr bool isEnabled()
+    {
+#ifdef MATIOCPP_ENABLE_TRACING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Start recording, discarding the events recorded previously
+     * @param eventsPerThread The maximum number of events stored for each thread.
+     * @return False if the tracing is not available.
+     */
+    static bool start(size_t eventsPerThread = 65536);
+
+    /**
+     * @brief Stop recording. The recorded events are kept until the next call to start.
+     */
+    static void stop();
+
+    /**
+     * @brief Check if the events are being recorded
+     * @return True if recording.
+     */
+    static bool isRecording();
+
+    /**
+     * @brief Get the number of events dropped because the buffer of a thread was full
+     * @return The number of dropped events since the last call to start.
+     */
+    static size_t droppedEvents();
+
+    /**
+     * @brief Write the recorded events in the Chrome trace-event JSON format
+     * @param output The stream where to write the events.
+     * @note It can be called while recording. In this case, only the events completed so far are written.
+     */
+    static void writeChromeTrace(std::ostream& output);
+
+    /**
+     * @brief Write the recorded events to a file in the Chrome trace-event JSON format
+     * @param fileName The name of the output file.
+     * @return True if successful.
+     */
+    static bool writeChromeTrace(const std::string& fileName);
+
+    /**
+     * @brief Record an event of the calling thread
+     *
+     * This is used by the library instrumentation. Events are ignored if not recording.
+     * @param name The name of the event. It has to be a string literal.
+     * @param begin The time at which the event started.
+     * @param end The time at which the event ended.
+     * @param detail Additional text, like the name of a variable. It can be null. It is truncated to 63 characters.
+     * @param bytes The size of the processed data.
+     */
+    static void record(const char* name, const time_point& begin, const time_point& end, const char* detail, size_t bytes);
+};
+
+#endif // MATIOCPP_TRACING_H
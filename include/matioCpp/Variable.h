@@ -22,10 +22,74 @@
 class matioCpp::Variable
 {
 
+    friend class matioCpp::AsyncFileWriter; // To take the matvar_t of the variables passed as rvalues
+
     matioCpp::MatvarHandler* m_handler;
 
+    /**
+     * @brief The matvar_t and its data pointer, valid as long as the generation of the handler does not change.
+     *
+     * The fields are atomic since the cache is refreshed also by the const methods, that can be called concurrently.
+     */
+    struct DataCache
+    {
+        std::atomic<void*> data{nullptr}; /** The cached data pointer. **/
+        std::atomic<const matvar_t*> matvar{nullptr}; /** The cached matvar_t. **/
+        std::atomic<uint64_t> generation{0}; /** The generation at which data has been cached. Zero if the cache is not valid. **/
+    };
+
+    mutable DataCache m_dataCache;
+
+    /**
+     * @brief Check if the cache is valid
+     * @return True if the generation of the handler did not change since the cache has been refreshed.
+     */
+    bool isDataCacheValid() const
+    {
+        const std::atomic<uint64_t>* counter = m_handler ? m_handler->generation() : nullptr;
+        return counter && (m_dataCache.generation.load(std::memory_order_acquire) == counter->load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Get the matvar_t and its data pointer from the handler and store them in the cache
+     * @return The matvar_t, or null if the variable is not valid.
+     */
+    const matvar_t* refreshDataCache() const;
+
 protected:
 
+    /**
+     * @brief Get the data pointer of the matvar_t
+     *
+     * Differently from toMatio()->data, the handler is queried only if a matvar_t of the same variable tree has been replaced,
+     * dropped or deleted since the last call. This avoids locking the ownership at every access to the elements of nested variables.
+     * @return The data pointer of the matvar_t, or null if the variable is not valid.
+     */
+    void* cachedData() const
+    {
+        if (isDataCacheValid())
+        {
+            return m_dataCache.data.load(std::memory_order_relaxed);
+        }
+        const matvar_t* matvar = refreshDataCache();
+        return matvar ? matvar->data : nullptr;
+    }
+
+    /**
+     * @brief Get the matvar_t, with the same caching of cachedData()
+     *
+     * Its dimensions can be read directly, for example to compute the position of an element, without querying the handler at every access.
+     * @return The matvar_t, or null if the variable is not valid.
+     */
+    const matvar_t* cachedMatvar() const
+    {
+        if (isDataCacheValid())
+        {
+            return m_dataCache.matvar.load(std::memory_order_relaxed);
+        }
+        return refreshDataCache();
+    }
+
     /**
      * @brief Initialize the variable.
      *
@@ -37,9 +101,14 @@ protected:
      * @param valueType The type of each element in the variable
      * @param dimensions Vector containing the variable dimensions. The size of this vector should be at least 2.
      * @param data A void pointer to the (flattened) data.
+     * @param dataOwnership Specifies if the data is copied or borrowed.
+     * When borrowed, the variable points directly to data, which is never deallocated by matioCpp.
+     * Hence, data has to outlive the variable and all the variables sharing its content. This is not available for cell arrays and structs.
+     * @param dataOwner Optional object owning the borrowed data. It is kept alive until the variable, and all the variables sharing its content, do not need data anymore.
      * @return true in case the variable was correctly initialized.
      */
-    bool initializeVariable(const std::string &name, const VariableType &variableType, const ValueType &valueType, matioCpp::Span<const size_t> dimensions, void *data);
+    bool initializeVariable(const std::string &name, const VariableType &variableType, const ValueType &valueType, matioCpp::Span<const size_t> dimensions, void *data,
+                            matioCpp::DataOwnership dataOwnership = matioCpp::DataOwnership::Copy, std::shared_ptr<void> dataOwner = nullptr);
 
     /**
      * @brief Initialize a complex variable
@@ -89,6 +158,24 @@ protected:
      */
     size_t getArrayNumberOfElements() const;
 
+    /**
+     * @brief Change the dimensions of the variable, considered as a cell array or a struct array, preserving its elements
+     *
+     * The elements whose indices are within the new dimensions are kept, without copying them. The other elements are deleted,
+     * while the new elements are empty. The table of the elements keeps spare capacity, so that growing the array
+     * along its last dimension has a constant amortized cost.
+     * @param newDimensions The new dimensions. The size of this vector should be at least 2.
+     * @return True if successful, false otherwise, for example if the variable is a view of an element of another variable.
+     */
+    bool resizeArray(matioCpp::Span<const size_t> newDimensions);
+
+    /**
+     * @brief Add empty elements at the end of the variable, considered as a one-dimensional cell array or struct array
+     * @param numberOfElements The number of elements to add.
+     * @return True if successful, false otherwise, for example if the array has more than one row and more than one column.
+     */
+    bool appendArrayElements(size_t numberOfElements);
+
     /**
      * @brief Set a cell element at a specified linear position
      * @param linearIndex The linear index of the specified element
@@ -97,6 +184,16 @@ protected:
      */
     bool setCellElement(size_t linearIndex, const Variable& newValue);
 
+    /**
+     * @brief Set a cell element at a specified linear position
+     * @param linearIndex The linear index of the specified element
+     * @param newValue The Variable that will be moved in the specified location.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. In this case, it becomes invalid.
+     * Otherwise, it is copied.
+     * @return True if successful, false otherwise
+     */
+    bool setCellElement(size_t linearIndex, Variable&& newValue);
+
     /**
      * @brief Get a cell element at a specified linear position
      * @param linearIndex The linear index of the specified element
@@ -124,6 +221,23 @@ protected:
      */
     char * const *getStructFields() const;
 
+    /**
+     * @brief Take the matvar_t pointer of another variable, if the other variable is its only owner
+     * @param other The variable giving up its pointer. It becomes invalid in case of success.
+     * @return The pointer, which has to be freed by the caller (or passed to a variable taking ownership of it).
+     * It is null if the pointer is shared with other variables, or if it is not owned by other.
+     */
+    static matvar_t* releaseMatvar(Variable& other);
+
+    /**
+     * @brief Change the size of the buffer containing the data of the variable, preserving its content
+     *
+     * The dimensions are not changed. Hence, the buffer can be larger than needed, leaving space to add elements without reallocating.
+     * @param bytes The new size of the buffer in bytes.
+     * @return True if successful, false if the variable is not valid, if it is a view of another variable, if it does not own its data, or if the allocation failed.
+     */
+    bool reallocateData(size_t bytes);
+
     /**
      * @brief Get the index of the specified field in the variable, considered as a struct
      * @param field The field to search
@@ -141,6 +255,17 @@ protected:
      */
     bool setStructField(size_t index, const Variable& newValue, size_t structPositionInArray = 0);
 
+    /**
+     * @brief Set the field of the struct at the specified position
+     * @param index The linear index of the specified field
+     * @param newValue The Variable that will be moved in the specified location.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. In this case, it becomes invalid.
+     * Otherwise, it is copied.
+     * @param structPositionInArray The linear position of the struct to set in the struct array
+     * @return True if successful, false otherwise (for example if the newValue is not valid)
+     */
+    bool setStructField(size_t index, Variable&& newValue, size_t structPositionInArray = 0);
+
     /**
      * @brief Add a new field to the variable, considered as a struct
      * @param newField The new field
@@ -148,6 +273,14 @@ protected:
      */
     bool addStructField(const std::string& newField);
 
+    /**
+     * @brief Set many fields of the variable, considered as a struct, given the names of the new values
+     * @param newValues The Variables that will be moved in the corresponding fields. The fields that are not found are appended.
+     * A Variable is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. Otherwise, it is copied.
+     * @return True on success, false otherwise, for example if the struct is part of an array, or if two new values have the same name
+     */
+    bool setStructFields(std::vector<Variable>&& newValues);
+
     /**
      * @brief Set the field of the struct given the newValue name
      * @param field The field to set
@@ -159,6 +292,19 @@ protected:
      */
     bool setStructField(const std::string &field, const Variable& newValue, size_t structPositionInArray = 0);
 
+    /**
+     * @brief Set the field of the struct given the newValue name
+     * @param field The field to set
+     * @param newValue The Variable that will be moved in the specified field.
+     * It is moved only if it is the only owner of its data, i.e. if no other variable is sharing it. In this case, it becomes invalid.
+     * Otherwise, it is copied.
+     * @param structPositionInArray The linear position of the struct to set in the struct array
+     * @return True if successful, false otherwise (for example if the newValue is not valid)
+     * @note If the field is not found, a new field is created and appended to the struct,
+     *  but only if the struct is not part of an array.
+     */
+    bool setStructField(const std::string &field, Variable&& newValue, size_t structPositionInArray = 0);
+
     /**
      * @brief Get the specified field in the variable, considered as a struct
      * @param index The index of the field
@@ -223,7 +369,7 @@ public:
     /**
      * @brief Move constructor
      */
-    Variable(Variable&& other);
+    Variable(Variable&& other) noexcept;
 
     /**
      * @brief Constructor to share the data ownership of another variable.
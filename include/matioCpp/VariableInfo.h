@@ -0,0 +1,64 @@
+#ifndef MATIOCPP_VARIABLEINFO_H
+#define MATIOCPP_VARIABLEINFO_H
+
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/ForwardDeclarations.h>
+
+/**
+ * @brief Lightweight description of a variable stored in a file, obtained without reading its data.
+ */
+class matioCpp::VariableInfo
+{
+public:
+
+    std::string name; /** The name of the variable. It is empty for the elements of a cell array. **/
+
+    matioCpp::VariableType variableType{matioCpp::VariableType::Unsupported}; /** The type of variable. **/
+
+    matioCpp::ValueType valueType{matioCpp::ValueType::UNSUPPORTED}; /** The type of the elements. **/
+
+    std::vector<size_t> dimensions; /** The dimensions of the variable. **/
+
+    bool isComplex{false}; /** True if the variable is complex. **/
+
+    size_t estimatedBytes{0}; /** Estimate of the memory needed to store the data of the variable, including its fields or elements. **/
+
+    /**
+     * The description of the fields of a struct (or of the first element of a struct array),
+     * or of the elements of a cell array.
+     */
+    std::vector<matioCpp::VariableInfo> children;
+
+    bool valid{false}; /** True if the description has been retrieved successfully. **/
+
+    /**
+     * @brief Check if the description is valid
+     * @return True if valid
+     */
+    bool isValid() const
+    {
+        return valid;
+    }
+
+    /**
+     * @brief Get the total number of elements
+     * @return The product of the dimensions
+     */
+    size_t numberOfElements() const
+    {
+        size_t output = 1;
+        for (size_t dim : dimensions)
+        {
+            output *= dim;
+        }
+        return output;
+    }
+};
+
+#endif // MATIOCPP_VARIABLEINFO_H
@@ -86,6 +86,25 @@ public:
                                                 !std::is_same<value_type, bool>::value>::type>
     Vector(const std::string& name, Span<const element_type> inputVector);
 
+    /**
+     * @brief Constructor
+     * @param name The name of the Vector
+     * @param inputVector The input data.
+     * @param dataOwnership Specifies if the input data is copied or borrowed.
+     * @warning When the data is borrowed, the Vector points directly to the memory of inputVector, without copying it.
+     * The input memory is never deallocated by the Vector and it has to outlive it, together with all the variables sharing its content.
+     * Operations changing the size of the Vector make it copy the data.
+     */
+    Vector(const std::string& name, Span<element_type> inputVector, matioCpp::DataOwnership dataOwnership);
+
+    /**
+     * @brief Constructor
+     * @param name The name of the Vector
+     * @param inputVector The input vector. Its storage is adopted by the Vector without copying the data.
+     * @note The adopted storage is released when the Vector, and all the variables sharing its content, are deallocated.
+     */
+    Vector(const std::string& name, std::vector<element_type>&& inputVector);
+
     /**
      * @brief Constructor
      * @param name The name of the Vector
@@ -183,14 +202,48 @@ public:
      */
     index_type size() const;
 
+    /**
+     * @brief Get the number of elements that the vector can contain without reallocating its data.
+     * @return The capacity of the Vector. It is equal to the size if the data is not owned by the vector, e.g. if it is borrowed.
+     */
+    index_type capacity() const;
+
+    /**
+     * @brief Increase the capacity of the vector
+     *
+     * The data is reallocated only if the new capacity is greater than the current one.
+     * If the data is not owned by the vector, e.g. if it is borrowed, it is first copied.
+     * @param newCapacity The minimum number of elements that the vector can contain without reallocating its data.
+     * @return True if successful, false otherwise, for example if the vector is a view of an element of a struct or of a cell array.
+     * @note In case of reallocation, the pointers to the elements of this vector, and of the variables sharing its data, are invalidated.
+     */
+    bool reserve(index_type newCapacity);
+
     /**
      * @brief Resize the vector.
-     * @param newSize The new size.
      *
-     * @warning This requires to allocate memory for twice the new size.
+     * The capacity grows geometrically, hence increasing the size of the vector by one element has a constant amortized cost.
+     * The new elements are set to zero.
+     * @param newSize The new size.
      */
     void resize(index_type newSize);
 
+    /**
+     * @brief Add an element at the end of the vector.
+     *
+     * The capacity grows geometrically, hence the amortized cost is constant.
+     * @param value The value to add.
+     * @return True if successful, false otherwise, for example if the vector is a view of an element of a struct or of a cell array.
+     */
+    bool push_back(const element_type& value);
+
+    /**
+     * @brief Add elements at the end of the vector.
+     * @param values The values to add. They can be part of the vector itself.
+     * @return True if successful, false otherwise, for example if the vector is a view of an element of a struct or of a cell array.
+     */
+    bool append(Span<const element_type> values);
+
     /**
      * @brief Clear the vector
      */
@@ -341,6 +394,26 @@ private:
      */
     bool initializeVector(const std::string& name, Span<const element_type> inputVector);
 
+    /**
+     * @brief Private utility method to reallocate the data of the vector, copying it first if it is not owned.
+     * @param newCapacity The number of elements that can be stored in the new buffer. It cannot be smaller than the size.
+     * @return True if successful.
+     */
+    bool reallocateVector(index_type newCapacity);
+
+    /**
+     * @brief Private utility method to compute the capacity needed to store a given number of elements.
+     * @param requiredSize The number of elements to store.
+     * @return The current capacity if sufficient, otherwise the maximum between the required size and twice the current capacity.
+     */
+    index_type grownCapacity(index_type requiredSize) const;
+
+    /**
+     * @brief Private utility method to change the dimensions of the vector, keeping its orientation.
+     * @param newSize The new size. It cannot be greater than the capacity.
+     */
+    void setVectorSize(index_type newSize);
+
     /**
      * @brief Check if an input matio pointer is compatible with the vector class.
      * @param inputPtr The input matvar_t pointer.
@@ -19,6 +19,12 @@ class matioCpp::WeakMatvar : public matioCpp::MatvarHandler
      */
     std::weak_ptr<MatvarHandler::Ownership> m_ownership;
 
+    /**
+     * @brief Get the ownership object
+     * @return A pointer to the ownership object. It is null if the owner has been deallocated.
+     */
+    virtual std::shared_ptr<MatvarHandler::Ownership> lockOwnership() const final;
+
     friend class matioCpp::SharedMatvar;
 
 public:
@@ -102,7 +108,7 @@ public:
      *
      * This always returns false.
      */
-    virtual bool importMatvar(matvar_t *) final;
+    virtual bool importMatvar(matvar_t *, matioCpp::DeleteMode = matioCpp::DeleteMode::Delete, std::shared_ptr<void> = nullptr) final;
 
     /**
      * Docs inherited
@@ -119,6 +125,11 @@ public:
      */
     virtual void dropOwnedPointer(matvar_t* previouslyOwnedPointer) final;
 
+    /**
+     * Docs inherited
+     */
+    virtual matvar_t* releaseMatvar() final;
+
     /**
      * @brief Copy assignement
      * @param other The other object to copy.
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#ifndef MATIOCPP_CELLARRAY_TPP
+#define MATIOCPP_CELLARRAY_TPP
+
+template<size_t N>
+typename matioCpp::CellArray::index_type matioCpp::CellArray::rawIndexFromIndices(const std::array<typename matioCpp::CellArray::index_type, N> &el) const
+{
+    const matvar_t* array = cachedMatvar();
+    assert(array && "[matioCpp::CellArray::rawIndexFromIndices] The array is not valid.");
+    return matioCpp::MultiIndex::RawIndexFromIndices(matioCpp::make_span(array->dims, array->rank), el);
+}
+
+template<typename... Indices>
+matioCpp::Variable matioCpp::CellArray::operator()(typename matioCpp::CellArray::index_type i0, typename matioCpp::CellArray::index_type i1, Indices... others)
+{
+    return getCellElement(rawIndexFromIndices(std::array<index_type, 2 + sizeof...(Indices)>{{i0, i1, static_cast<index_type>(others)...}}));
+}
+
+template<typename... Indices>
+const matioCpp::Variable matioCpp::CellArray::operator()(typename matioCpp::CellArray::index_type i0, typename matioCpp::CellArray::index_type i1, Indices... others) const
+{
+    return getCellElement(rawIndexFromIndices(std::array<index_type, 2 + sizeof...(Indices)>{{i0, i1, static_cast<index_type>(others)...}}));
+}
+
+template<size_t N>
+matioCpp::Variable matioCpp::CellArray::operator()(const std::array<typename matioCpp::CellArray::index_type, N> &el)
+{
+    return getCellElement(rawIndexFromIndices(el));
+}
+
+template<size_t N>
+const matioCpp::Variable matioCpp::CellArray::operator()(const std::array<typename matioCpp::CellArray::index_type, N> &el) const
+{
+    return getCellElement(rawIndexFromIndices(el));
+}
+
+template<size_t N>
+matioCpp::Variable matioCpp::CellArray::operator[](const std::array<typename matioCpp::CellArray::index_type, N> &el)
+{
+    return getCellElement(rawIndexFromIndices(el));
+}
+
+template<size_t N>
+const matioCpp::Variable matioCpp::CellArray::operator[](const std::array<typename matioCpp::CellArray::index_type, N> &el) const
+{
+    return getCellElement(rawIndexFromIndices(el));
+}
+
+#endif // MATIOCPP_CELLARRAY_TPP
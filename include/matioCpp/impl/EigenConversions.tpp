@@ -159,6 +159,8 @@ inline const Eigen::Map<Eigen::Matrix<type, Eigen::Dynamic, 1>> matioCpp::to_eig
 template <typename EigenDerived, typename>
 inline matioCpp::MultiDimensionalArray<typename EigenDerived::Scalar> matioCpp::make_variable(const std::string& name, const Eigen::MatrixBase<EigenDerived>& input)
 {
+    matioCpp::Tracing::ScopedEvent event("make_variable");
+    event.setDetails(name.c_str(), static_cast<size_t>(input.size()) * sizeof(typename EigenDerived::Scalar));
     matioCpp::MultiDimensionalArray<typename EigenDerived::Scalar> matio(name, {static_cast<size_t>(input.rows()), static_cast<size_t>(input.cols())});
     matioCpp::to_eigen(matio) = input;
     return matio;
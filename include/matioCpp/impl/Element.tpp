@@ -139,13 +139,13 @@ matioCpp::Element<T> &matioCpp::Element<T>::operator=(typename matioCpp::Element
 template<typename T>
 matioCpp::Span<typename matioCpp::Element<T>::element_type> matioCpp::Element<T>::toSpan()
 {
-    return matioCpp::make_span(static_cast<typename matioCpp::Element<T>::pointer>(toMatio()->data), 1);
+    return matioCpp::make_span(static_cast<typename matioCpp::Element<T>::pointer>(cachedData()), 1);
 }
 
 template<typename T>
 const matioCpp::Span<const typename matioCpp::Element<T>::element_type> matioCpp::Element<T>::toSpan() const
 {
-    return matioCpp::make_span(static_cast<typename matioCpp::Element<T>::const_pointer>(toMatio()->data), 1);
+    return matioCpp::make_span(static_cast<typename matioCpp::Element<T>::const_pointer>(cachedData()), 1);
 }
 
 template<typename T>
@@ -157,19 +157,19 @@ bool matioCpp::Element<T>::setName(const std::string &newName)
 template<typename T>
 typename matioCpp::Element<T>::reference matioCpp::Element<T>::operator()()
 {
-    return (((typename matioCpp::Element<T>::pointer)(toMatio()->data))[0]);
+    return (((typename matioCpp::Element<T>::pointer)(cachedData()))[0]);
 }
 
 template<typename T>
 typename matioCpp::Element<T>::value_type matioCpp::Element<T>::operator()() const
 {
-    return (((typename matioCpp::Element<T>::const_pointer)(toMatio()->data))[0]);
+    return (((typename matioCpp::Element<T>::const_pointer)(cachedData()))[0]);
 }
 
 template<typename T>
 matioCpp::Element<T>::operator typename matioCpp::Element<T>::element_type() const
 {
-    return (((typename matioCpp::Element<T>::const_pointer)(toMatio()->data))[0]);
+    return (((typename matioCpp::Element<T>::const_pointer)(cachedData()))[0]);
 }
 
 template<typename T>
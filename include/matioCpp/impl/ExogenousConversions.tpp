@@ -14,6 +14,12 @@ inline matioCpp::Vector<typename std::remove_cv_t<typename  matioCpp::SpanUtils:
     return matioCpp::Vector<typename std::remove_cv_t<type>>(name, matioCpp::make_span(input)); //data is copied
 }
 
+template <typename type, typename>
+inline matioCpp::Vector<type> matioCpp::make_variable(const std::string& name, std::vector<type>&& input)
+{
+    return matioCpp::Vector<type>(name, std::move(input)); //data is not copied
+}
+
 template<typename type, typename>
 inline matioCpp::Element<type> matioCpp::make_variable(const std::string& name, const type& input)
 {
@@ -23,6 +29,8 @@ inline matioCpp::Element<type> matioCpp::make_variable(const std::string& name,
 template<typename Struct, typename>
 inline matioCpp::Struct matioCpp::make_variable(const std::string& name, const Struct& input)
 {
+    matioCpp::Tracing::ScopedEvent event("make_variable");
+    event.setDetails(name.c_str());
     matioCpp::Struct matioStruct(name);
 
     visit_struct::for_each(input,
@@ -39,14 +47,29 @@ template<class iterator,
           typename>
 inline matioCpp::Struct matioCpp::make_struct(const std::string& name, iterator begin, iterator end)
 {
-    matioCpp::Struct matioStruct(name);
+    matioCpp::Tracing::ScopedEvent event("make_struct");
+    event.setDetails(name.c_str());
+    std::vector<matioCpp::Variable> fields;
+    std::unordered_map<std::string, size_t> fieldPositions;
     for (iterator it = begin; it != end; it++)
     {
-        bool ok = matioStruct.setField(make_variable(it->first, it->second));
-        matioCpp::unused(ok);
-        assert(ok);
+        std::pair<std::unordered_map<std::string, size_t>::iterator, bool> inserted = fieldPositions.emplace(it->first, fields.size());
+        if (inserted.second)
+        {
+            fields.emplace_back(make_variable(it->first, it->second));
+        }
+        else
+        {
+            //A repeated key replaces the previous value, keeping its position
+            fields[inserted.first->second] = make_variable(it->first, it->second);
+        }
     }
 
+    matioCpp::Struct matioStruct(name);
+    bool ok = matioStruct.setFields(std::move(fields));
+    matioCpp::unused(ok);
+    assert(ok);
+
     return matioStruct;
 }
 
@@ -54,6 +77,8 @@ template<class iterator,
          typename std::enable_if_t<matioCpp::is_pair_iterator_string<iterator>::value>*>
 inline matioCpp::CellArray matioCpp::make_cell_array(const std::string& name, const iterator& begin, const iterator& end)
 {
+    matioCpp::Tracing::ScopedEvent event("make_cell_array");
+    event.setDetails(name.c_str());
     matioCpp::CellArray matioCellArray(name, {static_cast<size_t>(std::distance(begin, end)), 1});
 
     size_t index = 0;
@@ -74,6 +99,8 @@ template<class iterator,
          typename std::enable_if_t<!matioCpp::is_pair<decltype(*std::declval<iterator>())>::value>*>
 inline matioCpp::CellArray matioCpp::make_cell_array(const std::string& name, const iterator& begin, const iterator& end)
 {
+    matioCpp::Tracing::ScopedEvent event("make_cell_array");
+    event.setDetails(name.c_str());
     matioCpp::CellArray matioCellArray(name, {static_cast<size_t>(std::distance(begin, end)), 1});
 
     size_t index = 0;
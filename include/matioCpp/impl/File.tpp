@@ -23,15 +23,31 @@ const input &matioCpp::File::getVariable(const std::pair<key, input>& it)
 template <class iterator>
 bool matioCpp::File::write(iterator begin, iterator end, Compression compression)
 {
+    std::vector<const matioCpp::Variable*> variables;
+    std::deque<matioCpp::Variable> copies; // The variables returned by value by the iterator, kept alive until they are written
     for (iterator it = begin; it != end; ++it)
     {
-        if (!write(getVariable(*it), compression))
+        if (std::is_lvalue_reference<decltype(*it)>::value)
         {
-            return false;
+            variables.push_back(&getVariable(*it));
+        }
+        else
+        {
+            copies.emplace_back(getVariable(*it));
+            variables.push_back(&copies.back());
         }
     }
 
-    return true;
+    return writeBatch(variables, compression);
+}
+
+template <typename T>
+bool matioCpp::File::appendRows(const std::string& name, const matioCpp::Span<T>& rows)
+{
+    using element_type = typename std::remove_cv_t<T>;
+    static_assert(std::is_arithmetic<element_type>::value && !std::is_same<element_type, bool>::value,
+                  "appendRows supports only numeric types.");
+    return appendRowsImpl(name, rows.data(), static_cast<size_t>(rows.size()), matioCpp::get_type<element_type>::valueType());
 }
 
 #endif // MATIOCPP_FILE_TPP
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#ifndef MATIOCPP_FIXEDRANKVIEW_TPP
+#define MATIOCPP_FIXEDRANKVIEW_TPP
+
+template<typename T, size_t N>
+bool matioCpp::FixedRankView<T, N>::initialize(typename matioCpp::FixedRankView<T, N>::pointer data, matioCpp::Span<const size_t> dimensions)
+{
+    m_dimensions.fill(1);
+
+    for (size_t i = 0; i < static_cast<size_t>(dimensions.size()); ++i)
+    {
+        if (i < N)
+        {
+            m_dimensions[i] = dimensions[i];
+        }
+        else if (dimensions[i] != 1)
+        {
+            std::cerr << "[ERROR][matioCpp::FixedRankView::FixedRankView] The input variable has " << dimensions.size()
+                      << " dimensions, while the view has " << N << " dimensions. Only the trailing dimensions equal to 1 can be dropped." << std::endl;
+            m_dimensions.fill(0);
+            m_strides.fill(0);
+            return false;
+        }
+    }
+
+    m_strides[0] = 1;
+    for (size_t i = 1; i < N; ++i)
+    {
+        m_strides[i] = m_strides[i - 1] * m_dimensions[i - 1];
+    }
+    m_numberOfElements = m_strides[N - 1] * m_dimensions[N - 1];
+    m_data = data;
+    m_valid = true;
+
+    return true;
+}
+
+template<typename T, size_t N>
+bool matioCpp::FixedRankView<T, N>::checkCompatibility(const matioCpp::Variable &variable)
+{
+    if (!variable.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::FixedRankView::FixedRankView] The input variable is not valid." << std::endl;
+        return false;
+    }
+
+    matioCpp::VariableType variableType = variable.variableType();
+    if ((variableType != matioCpp::VariableType::MultiDimensionalArray) &&
+        (variableType != matioCpp::VariableType::Vector) &&
+        (variableType != matioCpp::VariableType::Element))
+    {
+        std::cerr << "[ERROR][matioCpp::FixedRankView::FixedRankView] The variable " << variable.name() << " is not a numeric array." << std::endl;
+        return false;
+    }
+
+    if (variable.isComplex())
+    {
+        std::cerr << "[ERROR][matioCpp::FixedRankView::FixedRankView] The variable " << variable.name() << " is complex." << std::endl;
+        return false;
+    }
+
+    if (!matioCpp::is_convertible_to_primitive_type<value_type>(variable.valueType()))
+    {
+        std::cerr << "[ERROR][matioCpp::FixedRankView::FixedRankView] The value type of the variable " << variable.name()
+                  << " is not convertible to " << get_type<value_type>::toString() << "." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+template<typename T, size_t N>
+matioCpp::FixedRankView<T, N>::FixedRankView()
+{
+    m_dimensions.fill(0);
+    m_strides.fill(0);
+}
+
+template<typename T, size_t N>
+matioCpp::FixedRankView<T, N>::FixedRankView(matioCpp::Variable &variable)
+    : FixedRankView()
+{
+    if (checkCompatibility(variable))
+    {
+        initialize(static_cast<pointer>(variable.toMatio()->data), variable.dimensions());
+    }
+}
+
+template<typename T, size_t N>
+template<typename U, typename>
+matioCpp::FixedRankView<T, N>::FixedRankView(const matioCpp::Variable &variable)
+    : FixedRankView()
+{
+    if (checkCompatibility(variable))
+    {
+        initialize(static_cast<pointer>(variable.toMatio()->data), variable.dimensions());
+    }
+}
+
+template<typename T, size_t N>
+matioCpp::FixedRankView<T, N>::FixedRankView(matioCpp::MultiDimensionalArray<value_type> &array)
+    : FixedRankView()
+{
+    if (!array.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::FixedRankView::FixedRankView] The input array is not valid." << std::endl;
+        return;
+    }
+
+    initialize(array.data(), array.dimensions());
+}
+
+template<typename T, size_t N>
+template<typename U, typename>
+matioCpp::FixedRankView<T, N>::FixedRankView(const matioCpp::MultiDimensionalArray<value_type> &array)
+    : FixedRankView()
+{
+    if (!array.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::FixedRankView::FixedRankView] The input array is not valid." << std::endl;
+        return;
+    }
+
+    initialize(array.data(), array.dimensions());
+}
+
+template<typename T, size_t N>
+bool matioCpp::FixedRankView<T, N>::isValid() const
+{
+    return m_valid;
+}
+
+template<typename T, size_t N>
+constexpr size_t matioCpp::FixedRankView<T, N>::rank()
+{
+    return N;
+}
+
+template<typename T, size_t N>
+const std::array<typename matioCpp::FixedRankView<T, N>::index_type, N> &matioCpp::FixedRankView<T, N>::dimensions() const
+{
+    return m_dimensions;
+}
+
+template<typename T, size_t N>
+const std::array<typename matioCpp::FixedRankView<T, N>::index_type, N> &matioCpp::FixedRankView<T, N>::strides() const
+{
+    return m_strides;
+}
+
+template<typename T, size_t N>
+typename matioCpp::FixedRankView<T, N>::index_type matioCpp::FixedRankView<T, N>::numberOfElements() const
+{
+    return m_numberOfElements;
+}
+
+template<typename T, size_t N>
+typename matioCpp::FixedRankView<T, N>::pointer matioCpp::FixedRankView<T, N>::data() const
+{
+    return m_data;
+}
+
+template<typename T, size_t N>
+matioCpp::Span<typename matioCpp::FixedRankView<T, N>::element_type> matioCpp::FixedRankView<T, N>::toSpan() const
+{
+    return matioCpp::make_span(m_data, m_numberOfElements);
+}
+
+template<typename T, size_t N>
+typename matioCpp::FixedRankView<T, N>::index_type matioCpp::FixedRankView<T, N>::rawIndexFromIndices(const std::array<typename matioCpp::FixedRankView<T, N>::index_type, N> &el) const
+{
+    assert(el[0] < m_dimensions[0] && "[matioCpp::FixedRankView::rawIndexFromIndices] The required element is out of bounds.");
+
+    // The first stride is always 1, so that the compiler can vectorize the loops along the first dimension
+    index_type index = el[0];
+    for (size_t i = 1; i < N; ++i)
+    {
+        assert(el[i] < m_dimensions[i] && "[matioCpp::FixedRankView::rawIndexFromIndices] The required element is out of bounds.");
+        index += el[i] * m_strides[i];
+    }
+
+    return index;
+}
+
+template<typename T, size_t N>
+template<typename... Indices>
+typename matioCpp::FixedRankView<T, N>::reference matioCpp::FixedRankView<T, N>::operator()(Indices... indices) const
+{
+    static_assert (sizeof...(Indices) == N, "The number of indices should be equal to the rank of the view.");
+    return m_data[rawIndexFromIndices(std::array<index_type, N>{{static_cast<index_type>(indices)...}})];
+}
+
+template<typename T, size_t N>
+typename matioCpp::FixedRankView<T, N>::reference matioCpp::FixedRankView<T, N>::operator()(const std::array<typename matioCpp::FixedRankView<T, N>::index_type, N> &el) const
+{
+    return m_data[rawIndexFromIndices(el)];
+}
+
+template<typename T, size_t N>
+typename matioCpp::FixedRankView<T, N>::reference matioCpp::FixedRankView<T, N>::operator()(const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < m_numberOfElements && "[matioCpp::FixedRankView::operator()] The required element is out of bounds.");
+    return m_data[el.rawIndex()];
+}
+
+template<typename T, size_t N>
+typename matioCpp::FixedRankView<T, N>::reference matioCpp::FixedRankView<T, N>::operator[](const std::array<typename matioCpp::FixedRankView<T, N>::index_type, N> &el) const
+{
+    return m_data[rawIndexFromIndices(el)];
+}
+
+template<typename T, size_t N>
+typename matioCpp::FixedRankView<T, N>::reference matioCpp::FixedRankView<T, N>::operator[](const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < m_numberOfElements && "[matioCpp::FixedRankView::operator[]] The required element is out of bounds.");
+    return m_data[el.rawIndex()];
+}
+
+#endif // MATIOCPP_FIXEDRANKVIEW_TPP
@@ -105,6 +105,56 @@ matioCpp::MultiDimensionalArray<T>::MultiDimensionalArray(const std::string &nam
                        (void*)inputVector);
 }
 
+template<typename T>
+matioCpp::MultiDimensionalArray<T>::MultiDimensionalArray(const std::string &name, const std::vector<typename matioCpp::MultiDimensionalArray<T>::index_type> &dimensions, matioCpp::MultiDimensionalArray<T>::pointer inputVector, matioCpp::DataOwnership dataOwnership)
+{
+    for (matioCpp::MultiDimensionalArray<T>::index_type dim : dimensions)
+    {
+        if (dim == 0)
+        {
+            std::cerr << "[ERROR][matioCpp::MultiDimensionalArray::MultiDimensionalArray] Zero dimension detected." << std::endl;
+            assert(false);
+        }
+    }
+
+    initializeVariable(name,
+                       VariableType::MultiDimensionalArray,
+                       matioCpp::get_type<T>::valueType(), dimensions,
+                       (void*)inputVector, dataOwnership);
+}
+
+template<typename T>
+matioCpp::MultiDimensionalArray<T>::MultiDimensionalArray(const std::string &name, const std::vector<typename matioCpp::MultiDimensionalArray<T>::index_type> &dimensions, std::vector<typename matioCpp::MultiDimensionalArray<T>::element_type>&& inputVector)
+{
+    matioCpp::MultiDimensionalArray<T>::index_type totalElements = 1;
+    for (matioCpp::MultiDimensionalArray<T>::index_type dim : dimensions)
+    {
+        if (dim == 0)
+        {
+            std::cerr << "[ERROR][matioCpp::MultiDimensionalArray::MultiDimensionalArray] Zero dimension detected." << std::endl;
+            assert(false);
+        }
+
+        totalElements *= dim;
+    }
+
+    if (totalElements != inputVector.size())
+    {
+        std::cerr << "[ERROR][matioCpp::MultiDimensionalArray::MultiDimensionalArray] The size of the input vector does not match the specified dimensions." << std::endl;
+        assert(false);
+        inputVector.resize(totalElements);
+    }
+
+    //The storage of the input vector is moved in a shared object that is kept alive together with the matvar_t
+    std::shared_ptr<std::vector<typename matioCpp::MultiDimensionalArray<T>::element_type>> adoptedVector =
+        std::make_shared<std::vector<typename matioCpp::MultiDimensionalArray<T>::element_type>>(std::move(inputVector));
+
+    initializeVariable(name,
+                       VariableType::MultiDimensionalArray,
+                       matioCpp::get_type<T>::valueType(), dimensions,
+                       (void*)adoptedVector->data(), matioCpp::DataOwnership::Borrow, adoptedVector);
+}
+
 template<typename T>
 matioCpp::MultiDimensionalArray<T>::MultiDimensionalArray(const MultiDimensionalArray<T> &other)
 {
@@ -174,27 +224,38 @@ bool matioCpp::MultiDimensionalArray<T>::fromVectorizedArray(const std::vector<t
 template<typename T>
 typename matioCpp::MultiDimensionalArray<T>::index_type matioCpp::MultiDimensionalArray<T>::rawIndexFromIndices(const std::vector<typename matioCpp::MultiDimensionalArray<T>::index_type> &el) const
 {
-    assert(dimensions().size() > 0 && numberOfElements() > 0 && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The array is empty.");
-    assert(el.size() > 0 == dimensions().size() > 0 && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The input vector el should have the same number of dimensions of the array.");
-    assert(el[0] < dimensions()[0] && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The required element is out of bounds.");
+    matioCpp::Span<const size_t> dims = dimensions();
+    assert(dims.size() > 0 && numberOfElements() > 0 && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The array is empty.");
+    assert(el.size() > 0 == dims.size() > 0 && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The input vector el should have the same number of dimensions of the array.");
+    assert(el[0] < dims[0] && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The required element is out of bounds.");
 
     typename matioCpp::MultiDimensionalArray<T>::index_type index = 0;
     typename matioCpp::MultiDimensionalArray<T>::index_type previousDimensionsFactorial = 1;
 
     for (size_t i = 0; i < el.size(); ++i)
     {
-        assert(el[i] < dimensions()[i] && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The required element is out of bounds.");
+        assert(el[i] < dims[i] && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The required element is out of bounds.");
         index += el[i] * previousDimensionsFactorial;
-        previousDimensionsFactorial *= dimensions()[i];
+        previousDimensionsFactorial *= dims[i];
     }
 
     return index;
 }
 
+template<typename T>
+template<size_t N>
+typename matioCpp::MultiDimensionalArray<T>::index_type matioCpp::MultiDimensionalArray<T>::rawIndexFromIndices(const std::array<typename matioCpp::MultiDimensionalArray<T>::index_type, N> &el) const
+{
+    const matvar_t* array = cachedMatvar();
+    assert(array && "[matioCpp::MultiDimensionalArray::rawIndexFromIndices] The array is not valid.");
+    return matioCpp::MultiIndex::RawIndexFromIndices(matioCpp::make_span(array->dims, array->rank), el);
+}
+
 template<typename T>
 bool matioCpp::MultiDimensionalArray<T>::indicesFromRawIndex(size_t rawIndex, std::vector<typename matioCpp::MultiDimensionalArray<T>::index_type> &el) const
 {
-    el.resize(dimensions().size());
+    matioCpp::Span<const size_t> dims = dimensions();
+    el.resize(dims.size());
 
     if (rawIndex >= numberOfElements())
     {
@@ -202,14 +263,14 @@ bool matioCpp::MultiDimensionalArray<T>::indicesFromRawIndex(size_t rawIndex, st
         return false;
     }
 
-    typename matioCpp::MultiDimensionalArray<T>::index_type previousDimensionsFactorial = dimensions()[0];
+    typename matioCpp::MultiDimensionalArray<T>::index_type previousDimensionsFactorial = dims[0];
 
     //First we fill el with the factorial of the dimensions
 
     for (size_t i = 1; i < el.size(); ++i)
     {
         el[i - 1] = previousDimensionsFactorial;
-        previousDimensionsFactorial *= dimensions()[i];
+        previousDimensionsFactorial *= dims[i];
     }
 
     typename matioCpp::MultiDimensionalArray<T>::index_type remainder = rawIndex;
@@ -224,6 +285,12 @@ bool matioCpp::MultiDimensionalArray<T>::indicesFromRawIndex(size_t rawIndex, st
     return true;
 }
 
+template<typename T>
+matioCpp::MultiIndexRange matioCpp::MultiDimensionalArray<T>::indices() const
+{
+    return matioCpp::MultiIndexRange(dimensions());
+}
+
 template<typename T>
 matioCpp::Span<typename matioCpp::MultiDimensionalArray<T>::element_type> matioCpp::MultiDimensionalArray<T>::toSpan()
 {
@@ -274,13 +341,13 @@ void matioCpp::MultiDimensionalArray<T>::clear()
 template<typename T>
 typename matioCpp::MultiDimensionalArray<T>::pointer matioCpp::MultiDimensionalArray<T>::data()
 {
-    return static_cast<typename matioCpp::MultiDimensionalArray<T>::pointer>(toMatio()->data);
+    return static_cast<typename matioCpp::MultiDimensionalArray<T>::pointer>(cachedData());
 }
 
 template<typename T>
 typename matioCpp::MultiDimensionalArray<T>::const_pointer matioCpp::MultiDimensionalArray<T>::data() const
 {
-    return static_cast<typename matioCpp::MultiDimensionalArray<T>::const_pointer>(toMatio()->data);
+    return static_cast<typename matioCpp::MultiDimensionalArray<T>::const_pointer>(cachedData());
 }
 
 template<typename T>
@@ -341,6 +408,76 @@ typename matioCpp::MultiDimensionalArray<T>::value_type matioCpp::MultiDimension
     return data()[el];
 }
 
+template<typename T>
+template<typename... Indices>
+typename matioCpp::MultiDimensionalArray<T>::reference matioCpp::MultiDimensionalArray<T>::operator()(typename matioCpp::MultiDimensionalArray<T>::index_type i0, typename matioCpp::MultiDimensionalArray<T>::index_type i1, Indices... others)
+{
+    return data()[rawIndexFromIndices(std::array<index_type, 2 + sizeof...(Indices)>{{i0, i1, static_cast<index_type>(others)...}})];
+}
+
+template<typename T>
+template<typename... Indices>
+typename matioCpp::MultiDimensionalArray<T>::value_type matioCpp::MultiDimensionalArray<T>::operator()(typename matioCpp::MultiDimensionalArray<T>::index_type i0, typename matioCpp::MultiDimensionalArray<T>::index_type i1, Indices... others) const
+{
+    return data()[rawIndexFromIndices(std::array<index_type, 2 + sizeof...(Indices)>{{i0, i1, static_cast<index_type>(others)...}})];
+}
+
+template<typename T>
+template<size_t N>
+typename matioCpp::MultiDimensionalArray<T>::reference matioCpp::MultiDimensionalArray<T>::operator()(const std::array<typename matioCpp::MultiDimensionalArray<T>::index_type, N> &el)
+{
+    return data()[rawIndexFromIndices(el)];
+}
+
+template<typename T>
+template<size_t N>
+typename matioCpp::MultiDimensionalArray<T>::value_type matioCpp::MultiDimensionalArray<T>::operator()(const std::array<typename matioCpp::MultiDimensionalArray<T>::index_type, N> &el) const
+{
+    return data()[rawIndexFromIndices(el)];
+}
+
+template<typename T>
+template<size_t N>
+typename matioCpp::MultiDimensionalArray<T>::reference matioCpp::MultiDimensionalArray<T>::operator[](const std::array<typename matioCpp::MultiDimensionalArray<T>::index_type, N> &el)
+{
+    return data()[rawIndexFromIndices(el)];
+}
+
+template<typename T>
+template<size_t N>
+typename matioCpp::MultiDimensionalArray<T>::value_type matioCpp::MultiDimensionalArray<T>::operator[](const std::array<typename matioCpp::MultiDimensionalArray<T>::index_type, N> &el) const
+{
+    return data()[rawIndexFromIndices(el)];
+}
+
+template<typename T>
+typename matioCpp::MultiDimensionalArray<T>::reference matioCpp::MultiDimensionalArray<T>::operator()(const matioCpp::MultiIndex &el)
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::MultiDimensionalArray::operator()] The required element is out of bounds.");
+    return data()[el.rawIndex()];
+}
+
+template<typename T>
+typename matioCpp::MultiDimensionalArray<T>::value_type matioCpp::MultiDimensionalArray<T>::operator()(const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::MultiDimensionalArray::operator()] The required element is out of bounds.");
+    return data()[el.rawIndex()];
+}
+
+template<typename T>
+typename matioCpp::MultiDimensionalArray<T>::reference matioCpp::MultiDimensionalArray<T>::operator[](const matioCpp::MultiIndex &el)
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::MultiDimensionalArray::operator[]] The required element is out of bounds.");
+    return data()[el.rawIndex()];
+}
+
+template<typename T>
+typename matioCpp::MultiDimensionalArray<T>::value_type matioCpp::MultiDimensionalArray<T>::operator[](const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::MultiDimensionalArray::operator[]] The required element is out of bounds.");
+    return data()[el.rawIndex()];
+}
+
 template<typename T>
 matioCpp::MultiDimensionalArray<T> matioCpp::Variable::asMultiDimensionalArray()
 {
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#ifndef MATIOCPP_MULTIINDEX_TPP
+#define MATIOCPP_MULTIINDEX_TPP
+
+inline const std::vector<size_t> &matioCpp::MultiIndex::indices() const
+{
+    return m_indices;
+}
+
+inline size_t matioCpp::MultiIndex::rawIndex() const
+{
+    return m_rawIndex;
+}
+
+inline size_t matioCpp::MultiIndex::size() const
+{
+    return m_indices.size();
+}
+
+inline size_t matioCpp::MultiIndex::operator[](size_t dimension) const
+{
+    assert(dimension < m_indices.size() && "[matioCpp::MultiIndex::operator[]] The required dimension is out of bounds.");
+    return m_indices[dimension];
+}
+
+template<size_t N>
+inline size_t matioCpp::MultiIndex::RawIndexFromIndices(matioCpp::Span<const size_t> dimensions, const std::array<size_t, N>& el)
+{
+    static_assert(N > 0, "At least one index is needed.");
+    assert(static_cast<size_t>(dimensions.size()) == N && "[matioCpp::MultiIndex::RawIndexFromIndices] The number of indices should be equal to the number of dimensions of the array.");
+
+    const size_t* dims = dimensions.data();
+
+    // i + n * (j + m * (k + p * (...)))
+    size_t index = el[N - 1];
+    assert(el[N - 1] < dims[N - 1] && "[matioCpp::MultiIndex::RawIndexFromIndices] The required element is out of bounds.");
+    for (size_t i = N - 1; i > 0; --i)
+    {
+        assert(el[i - 1] < dims[i - 1] && "[matioCpp::MultiIndex::RawIndexFromIndices] The required element is out of bounds.");
+        index = index * dims[i - 1] + el[i - 1];
+    }
+
+    return index;
+}
+
+inline typename matioCpp::MultiIndexIterator::reference matioCpp::MultiIndexIterator::operator*() const
+{
+    return m_index;
+}
+
+inline typename matioCpp::MultiIndexIterator::pointer matioCpp::MultiIndexIterator::operator->() const
+{
+    return &m_index;
+}
+
+inline matioCpp::MultiIndexIterator &matioCpp::MultiIndexIterator::operator++()
+{
+    ++m_index.m_rawIndex;
+
+    // Odometer-like increment: the first index moves fastest, as in the column-major data
+    size_t* indices = m_index.m_indices.data();
+    const size_t* dimensions = m_dimensions.data();
+    const size_t rank = m_dimensions.size();
+    for (size_t i = 0; i < rank; ++i)
+    {
+        if (++indices[i] < dimensions[i])
+        {
+            return *this;
+        }
+        indices[i] = 0;
+    }
+
+    return *this;
+}
+
+inline matioCpp::MultiIndexIterator matioCpp::MultiIndexIterator::operator++(int)
+{
+    matioCpp::MultiIndexIterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+inline bool matioCpp::MultiIndexIterator::operator==(const matioCpp::MultiIndexIterator &other) const
+{
+    return m_index.m_rawIndex == other.m_index.m_rawIndex;
+}
+
+inline bool matioCpp::MultiIndexIterator::operator!=(const matioCpp::MultiIndexIterator &other) const
+{
+    return m_index.m_rawIndex != other.m_index.m_rawIndex;
+}
+
+#endif // MATIOCPP_MULTIINDEX_TPP
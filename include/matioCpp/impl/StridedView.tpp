@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#ifndef MATIOCPP_STRIDEDVIEW_TPP
+#define MATIOCPP_STRIDEDVIEW_TPP
+
+template<typename T>
+bool matioCpp::StridedView<T>::initialize(typename matioCpp::StridedView<T>::pointer data, matioCpp::Span<const size_t> dimensions, const std::vector<matioCpp::Slice> &slices)
+{
+    const size_t rank = static_cast<size_t>(dimensions.size());
+
+    if (slices.size() > rank)
+    {
+        std::cerr << "[ERROR][matioCpp::StridedView::StridedView] The number of slices (" << slices.size()
+                  << ") is greater than the number of dimensions of the array (" << rank << ")." << std::endl;
+        return false;
+    }
+
+    std::vector<index_type> viewDimensions(rank);
+    std::vector<index_type> viewStrides(rank);
+    index_type offset = 0;
+    index_type arrayStride = 1;
+    index_type numberOfElements = 1;
+
+    for (size_t i = 0; i < rank; ++i)
+    {
+        matioCpp::Slice slice = i < slices.size() ? slices[i] : matioCpp::Slice::All();
+        index_type stop = slice.stop() == matioCpp::Slice::End ? dimensions[i] : slice.stop();
+
+        if (slice.step() == 0)
+        {
+            std::cerr << "[ERROR][matioCpp::StridedView::StridedView] The step of the slice along dimension " << i << " is zero." << std::endl;
+            return false;
+        }
+
+        if (stop > dimensions[i])
+        {
+            std::cerr << "[ERROR][matioCpp::StridedView::StridedView] The slice along dimension " << i << " stops at " << stop
+                      << ", while the dimension is " << dimensions[i] << "." << std::endl;
+            return false;
+        }
+
+        if (slice.start() >= stop)
+        {
+            std::cerr << "[ERROR][matioCpp::StridedView::StridedView] The slice along dimension " << i << " does not select any element." << std::endl;
+            return false;
+        }
+
+        viewDimensions[i] = (stop - slice.start() + slice.step() - 1) / slice.step();
+        viewStrides[i] = slice.step() * arrayStride;
+        offset += slice.start() * arrayStride;
+        numberOfElements *= viewDimensions[i];
+        arrayStride *= dimensions[i];
+    }
+
+    // The singleton dimensions do not move in the data, while a dimension following a contiguous one continues it.
+    // Removing and merging them reduces the number of nested loops in copyTo, and makes the contiguous runs as long as possible.
+    m_loopDimensions.clear();
+    m_loopStrides.clear();
+    for (size_t i = 0; i < rank; ++i)
+    {
+        if (viewDimensions[i] == 1)
+        {
+            continue;
+        }
+
+        if (!m_loopDimensions.empty() && (viewStrides[i] == m_loopStrides.back() * m_loopDimensions.back()))
+        {
+            m_loopDimensions.back() *= viewDimensions[i];
+        }
+        else
+        {
+            m_loopDimensions.push_back(viewDimensions[i]);
+            m_loopStrides.push_back(viewStrides[i]);
+        }
+    }
+
+    if (m_loopDimensions.empty())
+    {
+        m_loopDimensions.push_back(1);
+        m_loopStrides.push_back(1);
+    }
+
+    m_data = data + offset;
+    m_dimensions = std::move(viewDimensions);
+    m_strides = std::move(viewStrides);
+    m_numberOfElements = numberOfElements;
+    m_valid = true;
+
+    return true;
+}
+
+template<typename T>
+void matioCpp::StridedView<T>::copyElements(typename get_type<typename matioCpp::StridedView<T>::value_type>::type *output) const
+{
+    const size_t loopRank = m_loopDimensions.size();
+    const index_type innerSize = m_loopDimensions[0];
+    const index_type innerStride = m_loopStrides[0];
+    const index_type outerSize = loopRank > 1 ? m_loopDimensions[1] : 1;
+    const index_type outerStride = loopRank > 1 ? m_loopStrides[1] : 0;
+    const index_type numberOfBlocks = m_numberOfElements / (innerSize * outerSize);
+
+    // The two innermost dimensions are copied as a block, while the remaining ones are visited with an odometer
+    std::vector<index_type> counters(loopRank > 2 ? loopRank - 2 : 0, 0);
+    index_type blockOffset = 0;
+
+    for (index_type block = 0; block < numberOfBlocks; ++block)
+    {
+        const element_type* column = m_data + blockOffset;
+        for (index_type j = 0; j < outerSize; ++j)
+        {
+            if (innerStride == 1)
+            {
+                std::copy_n(column, innerSize, output);
+            }
+            else
+            {
+                for (index_type i = 0; i < innerSize; ++i)
+                {
+                    output[i] = column[i * innerStride];
+                }
+            }
+            output += innerSize;
+            column += outerStride;
+        }
+
+        for (size_t d = 2; d < loopRank; ++d)
+        {
+            blockOffset += m_loopStrides[d];
+            if (++counters[d - 2] < m_loopDimensions[d])
+            {
+                break;
+            }
+            counters[d - 2] = 0;
+            blockOffset -= m_loopStrides[d] * m_loopDimensions[d];
+        }
+    }
+}
+
+template<typename T>
+matioCpp::StridedView<T>::StridedView()
+{
+}
+
+template<typename T>
+matioCpp::StridedView<T>::StridedView(matioCpp::MultiDimensionalArray<value_type> &array, const std::vector<matioCpp::Slice> &slices)
+{
+    if (!array.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StridedView::StridedView] The input array is not valid." << std::endl;
+        return;
+    }
+
+    initialize(array.data(), array.dimensions(), slices);
+}
+
+template<typename T>
+template<typename U, typename>
+matioCpp::StridedView<T>::StridedView(const matioCpp::MultiDimensionalArray<value_type> &array, const std::vector<matioCpp::Slice> &slices)
+{
+    if (!array.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StridedView::StridedView] The input array is not valid." << std::endl;
+        return;
+    }
+
+    initialize(array.data(), array.dimensions(), slices);
+}
+
+template<typename T>
+bool matioCpp::StridedView<T>::isValid() const
+{
+    return m_valid;
+}
+
+template<typename T>
+size_t matioCpp::StridedView<T>::rank() const
+{
+    return m_dimensions.size();
+}
+
+template<typename T>
+const std::vector<typename matioCpp::StridedView<T>::index_type> &matioCpp::StridedView<T>::dimensions() const
+{
+    return m_dimensions;
+}
+
+template<typename T>
+const std::vector<typename matioCpp::StridedView<T>::index_type> &matioCpp::StridedView<T>::strides() const
+{
+    return m_strides;
+}
+
+template<typename T>
+typename matioCpp::StridedView<T>::index_type matioCpp::StridedView<T>::numberOfElements() const
+{
+    return m_numberOfElements;
+}
+
+template<typename T>
+typename matioCpp::StridedView<T>::pointer matioCpp::StridedView<T>::data() const
+{
+    return m_data;
+}
+
+template<typename T>
+matioCpp::MultiIndexRange matioCpp::StridedView<T>::indices() const
+{
+    return matioCpp::MultiIndexRange(m_dimensions);
+}
+
+template<typename T>
+typename matioCpp::StridedView<T>::index_type matioCpp::StridedView<T>::rawIndexFromIndices(const std::vector<typename matioCpp::StridedView<T>::index_type> &el) const
+{
+    assert(el.size() == m_dimensions.size() && "[matioCpp::StridedView::rawIndexFromIndices] The number of indices should be equal to the rank of the view.");
+
+    index_type index = 0;
+    for (size_t i = 0; i < el.size(); ++i)
+    {
+        assert(el[i] < m_dimensions[i] && "[matioCpp::StridedView::rawIndexFromIndices] The required element is out of bounds.");
+        index += el[i] * m_strides[i];
+    }
+
+    return index;
+}
+
+template<typename T>
+template<size_t N>
+typename matioCpp::StridedView<T>::index_type matioCpp::StridedView<T>::rawIndexFromIndices(const std::array<typename matioCpp::StridedView<T>::index_type, N> &el) const
+{
+    assert(N == m_dimensions.size() && "[matioCpp::StridedView::rawIndexFromIndices] The number of indices should be equal to the rank of the view.");
+
+    const index_type* dimensions = m_dimensions.data();
+    const index_type* strides = m_strides.data();
+
+    index_type index = 0;
+    for (size_t i = 0; i < N; ++i)
+    {
+        assert(el[i] < dimensions[i] && "[matioCpp::StridedView::rawIndexFromIndices] The required element is out of bounds.");
+        index += el[i] * strides[i];
+    }
+
+    return index;
+}
+
+template<typename T>
+template<typename... Indices>
+typename matioCpp::StridedView<T>::reference matioCpp::StridedView<T>::operator()(typename matioCpp::StridedView<T>::index_type i0, Indices... others) const
+{
+    return m_data[rawIndexFromIndices(std::array<index_type, sizeof...(Indices) + 1>{{i0, static_cast<index_type>(others)...}})];
+}
+
+template<typename T>
+typename matioCpp::StridedView<T>::reference matioCpp::StridedView<T>::operator()(const std::vector<typename matioCpp::StridedView<T>::index_type> &el) const
+{
+    return m_data[rawIndexFromIndices(el)];
+}
+
+template<typename T>
+typename matioCpp::StridedView<T>::reference matioCpp::StridedView<T>::operator()(const matioCpp::MultiIndex &el) const
+{
+    return m_data[rawIndexFromIndices(el.indices())];
+}
+
+template<typename T>
+typename matioCpp::StridedView<T>::reference matioCpp::StridedView<T>::operator[](const std::vector<typename matioCpp::StridedView<T>::index_type> &el) const
+{
+    return m_data[rawIndexFromIndices(el)];
+}
+
+template<typename T>
+typename matioCpp::StridedView<T>::reference matioCpp::StridedView<T>::operator[](const matioCpp::MultiIndex &el) const
+{
+    return m_data[rawIndexFromIndices(el.indices())];
+}
+
+template<typename T>
+bool matioCpp::StridedView<T>::copyTo(matioCpp::Span<typename get_type<typename matioCpp::StridedView<T>::value_type>::type> output) const
+{
+    if (!m_valid)
+    {
+        std::cerr << "[ERROR][matioCpp::StridedView::copyTo] The view is not valid." << std::endl;
+        return false;
+    }
+
+    if (static_cast<size_t>(output.size()) != m_numberOfElements)
+    {
+        std::cerr << "[ERROR][matioCpp::StridedView::copyTo] The output has " << output.size()
+                  << " elements, while the view has " << m_numberOfElements << " elements." << std::endl;
+        return false;
+    }
+
+    copyElements(output.data());
+
+    return true;
+}
+
+template<typename T>
+bool matioCpp::StridedView<T>::copyTo(matioCpp::MultiDimensionalArray<value_type> &output) const
+{
+    if (!m_valid)
+    {
+        std::cerr << "[ERROR][matioCpp::StridedView::copyTo] The view is not valid." << std::endl;
+        return false;
+    }
+
+    matioCpp::Span<const size_t> outputDimensions = output.dimensions();
+    if (!std::equal(m_dimensions.begin(), m_dimensions.end(), outputDimensions.begin(), outputDimensions.end()))
+    {
+        output.resize(m_dimensions);
+
+        //The resize fails, for example, if the output is a field of a struct
+        outputDimensions = output.dimensions();
+        if (!std::equal(m_dimensions.begin(), m_dimensions.end(), outputDimensions.begin(), outputDimensions.end()))
+        {
+            std::cerr << "[ERROR][matioCpp::StridedView::copyTo] Failed to resize the output to the dimensions of the view." << std::endl;
+            return false;
+        }
+    }
+
+    copyElements(output.data());
+
+    return true;
+}
+
+#endif // MATIOCPP_STRIDEDVIEW_TPP
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#ifndef MATIOCPP_STRUCTARRAY_TPP
+#define MATIOCPP_STRUCTARRAY_TPP
+
+template<size_t N>
+typename matioCpp::StructArray::index_type matioCpp::StructArray::rawIndexFromIndices(const std::array<typename matioCpp::StructArray::index_type, N> &el) const
+{
+    const matvar_t* array = cachedMatvar();
+    assert(array && "[matioCpp::StructArray::rawIndexFromIndices] The array is not valid.");
+    return matioCpp::MultiIndex::RawIndexFromIndices(matioCpp::make_span(array->dims, array->rank), el);
+}
+
+template<typename... Indices>
+matioCpp::StructArray::Element matioCpp::StructArray::operator()(typename matioCpp::StructArray::index_type i0, typename matioCpp::StructArray::index_type i1, Indices... others)
+{
+    return matioCpp::StructArray::Element(rawIndexFromIndices(std::array<index_type, 2 + sizeof...(Indices)>{{i0, i1, static_cast<index_type>(others)...}}), this);
+}
+
+template<typename... Indices>
+matioCpp::StructArray::ConstElement matioCpp::StructArray::operator()(typename matioCpp::StructArray::index_type i0, typename matioCpp::StructArray::index_type i1, Indices... others) const
+{
+    return matioCpp::StructArray::ConstElement(rawIndexFromIndices(std::array<index_type, 2 + sizeof...(Indices)>{{i0, i1, static_cast<index_type>(others)...}}), this);
+}
+
+template<size_t N>
+matioCpp::StructArray::Element matioCpp::StructArray::operator()(const std::array<typename matioCpp::StructArray::index_type, N> &el)
+{
+    return matioCpp::StructArray::Element(rawIndexFromIndices(el), this);
+}
+
+template<size_t N>
+matioCpp::StructArray::ConstElement matioCpp::StructArray::operator()(const std::array<typename matioCpp::StructArray::index_type, N> &el) const
+{
+    return matioCpp::StructArray::ConstElement(rawIndexFromIndices(el), this);
+}
+
+template<size_t N>
+matioCpp::StructArray::Element matioCpp::StructArray::operator[](const std::array<typename matioCpp::StructArray::index_type, N> &el)
+{
+    return matioCpp::StructArray::Element(rawIndexFromIndices(el), this);
+}
+
+template<size_t N>
+matioCpp::StructArray::ConstElement matioCpp::StructArray::operator[](const std::array<typename matioCpp::StructArray::index_type, N> &el) const
+{
+    return matioCpp::StructArray::ConstElement(rawIndexFromIndices(el), this);
+}
+
+#endif // MATIOCPP_STRUCTARRAY_TPP
@@ -186,6 +186,22 @@ bool matioCpp::StructArrayElement<isConst>::setField(const Variable &newValue) c
     return setField(newValue.name(), newValue);
 }
 
+template <bool isConst>
+template<bool B, typename >
+bool matioCpp::StructArrayElement<isConst>::setField(const matioCpp::FieldHandle &field, const Variable &newValue) const
+{
+    static_assert ((B == isConst) && !B, "This method can be used only if the the element is not const.");
+
+    if (!field.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArrayElement::setField] The handle of the field " << field.name() << " is not valid." << std::endl;
+        return false;
+    }
+
+    assert(field.isValidFor(*m_array) && "The handle has not been obtained from this array, or the fields of the array have changed.");
+    return setField(field.index(), newValue);
+}
+
 template <bool isConst>
 typename matioCpp::StructArrayElement<isConst>::output_struct_type matioCpp::StructArrayElement<isConst>::asStruct() const
 {
@@ -222,4 +238,18 @@ typename matioCpp::StructArrayElement<isConst>::output_variable_type matioCpp::S
     return m_array->getStructField(index, m_innerIndex);
 }
 
+template <bool isConst>
+typename matioCpp::StructArrayElement<isConst>::output_variable_type matioCpp::StructArrayElement<isConst>::operator ()(const matioCpp::FieldHandle &field) const
+{
+    assert(field.isValidFor(*m_array) && "The handle has not been obtained from this array, or the fields of the array have changed.");
+    return m_array->getStructField(field.index(), m_innerIndex);
+}
+
+template <bool isConst>
+typename matioCpp::StructArrayElement<isConst>::output_variable_type matioCpp::StructArrayElement<isConst>::operator [](const matioCpp::FieldHandle &field) const
+{
+    assert(field.isValidFor(*m_array) && "The handle has not been obtained from this array, or the fields of the array have changed.");
+    return m_array->getStructField(field.index(), m_innerIndex);
+}
+
 #endif // MATIOCPP_STRUCTARRAYELEMENT_TPP
@@ -15,6 +15,49 @@ bool matioCpp::Vector<T>::initializeVector(const std::string& name, Span<const t
     return initializeVariable(name, VariableType::Vector, matioCpp::get_type<T>::valueType(), dimensions, (void*)inputVector.data());
 }
 
+template<typename T>
+bool matioCpp::Vector<T>::reallocateVector(typename matioCpp::Vector<T>::index_type newCapacity)
+{
+    if (reallocateData(newCapacity * sizeof(typename matioCpp::Vector<T>::element_type)))
+    {
+        return true;
+    }
+
+    //The data may be borrowed. In this case, it is first copied in a buffer owned by the vector.
+    //This fails if the vector is a view of another variable, since its dimensions cannot change.
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> dimensionsCopy(currentDimensions.begin(), currentDimensions.end());
+    if (!initializeVariable(name(), VariableType::Vector, valueType(), dimensionsCopy, (void*)data()))
+    {
+        return false;
+    }
+
+    return reallocateData(newCapacity * sizeof(typename matioCpp::Vector<T>::element_type));
+}
+
+template<typename T>
+typename matioCpp::Vector<T>::index_type matioCpp::Vector<T>::grownCapacity(typename matioCpp::Vector<T>::index_type requiredSize) const
+{
+    typename matioCpp::Vector<T>::index_type currentCapacity = capacity();
+    return requiredSize > currentCapacity ? std::max(requiredSize, 2 * currentCapacity) : currentCapacity;
+}
+
+template<typename T>
+void matioCpp::Vector<T>::setVectorSize(typename matioCpp::Vector<T>::index_type newSize)
+{
+    matvar_t* vector = toMatio();
+
+    if ((vector->dims[1] == 1) && (vector->dims[0] != 1)) //Column vector
+    {
+        vector->dims[0] = newSize;
+    }
+    else
+    {
+        vector->dims[0] = 1;
+        vector->dims[1] = newSize;
+    }
+}
+
 template<typename T>
 bool matioCpp::Vector<T>::checkCompatibility(const matvar_t* inputPtr, matioCpp::VariableType variableType, matioCpp::ValueType valueType) const
 {
@@ -113,6 +156,24 @@ matioCpp::Vector<T>::Vector(const std::string& name, Span<const typename matioCp
     initializeVector(name, inputVector);
 }
 
+template<typename T>
+matioCpp::Vector<T>::Vector(const std::string& name, Span<typename matioCpp::Vector<T>::element_type> inputVector, matioCpp::DataOwnership dataOwnership)
+{
+    size_t dimensions[] = {1, static_cast<size_t>(inputVector.size())};
+    initializeVariable(name, VariableType::Vector, matioCpp::get_type<T>::valueType(), dimensions, (void*)inputVector.data(), dataOwnership);
+}
+
+template<typename T>
+matioCpp::Vector<T>::Vector(const std::string& name, std::vector<typename matioCpp::Vector<T>::element_type>&& inputVector)
+{
+    //The storage of the input vector is moved in a shared object that is kept alive together with the matvar_t
+    std::shared_ptr<std::vector<typename matioCpp::Vector<T>::element_type>> adoptedVector =
+        std::make_shared<std::vector<typename matioCpp::Vector<T>::element_type>>(std::move(inputVector));
+    size_t dimensions[] = {1, adoptedVector->size()};
+    initializeVariable(name, VariableType::Vector, matioCpp::get_type<T>::valueType(), dimensions, (void*)adoptedVector->data(),
+                       matioCpp::DataOwnership::Borrow, adoptedVector);
+}
+
 template <typename T>
 matioCpp::Vector<T>::Vector(const std::string &name, const string_input_type &inputString)
 {
@@ -259,21 +320,107 @@ bool matioCpp::Vector<T>::setName(const std::string &newName)
 template<typename T>
 typename matioCpp::Vector<T>::index_type matioCpp::Vector<T>::size() const
 {
+    const size_t* dimensions = toMatio()->dims;
+
     //A vector should have the size of dimensions equal to 2
-    assert(this->dimensions().size() == 2);
+    assert(toMatio()->rank == 2);
+
+    return std::min(dimensions[0], dimensions[1]) > 0 ? std::max(dimensions[0], dimensions[1]) : 0;
+}
+
+template<typename T>
+typename matioCpp::Vector<T>::index_type matioCpp::Vector<T>::capacity() const
+{
+    //The data of a vector may be larger than needed. In this case, the size of the buffer is stored in nbytes
+    return std::max(size(), static_cast<typename matioCpp::Vector<T>::index_type>(toMatio()->nbytes / sizeof(typename matioCpp::Vector<T>::element_type)));
+}
+
+template<typename T>
+bool matioCpp::Vector<T>::reserve(typename matioCpp::Vector<T>::index_type newCapacity)
+{
+    if (newCapacity <= capacity())
+    {
+        return true;
+    }
 
-    return std::min(this->dimensions()[0], this->dimensions()[1]) > 0 ? std::max(this->dimensions()[0], this->dimensions()[1]) : 0;
+    if (!reallocateVector(newCapacity))
+    {
+        std::cerr << "[ERROR][matioCpp::Vector::reserve] Failed to reserve the space for " << newCapacity << " elements in " << name() << "." << std::endl;
+        return false;
+    }
+
+    return true;
 }
 
 template<typename T>
 void matioCpp::Vector<T>::resize(typename matioCpp::Vector<T>::index_type newSize)
 {
-    if (newSize != size())
+    typename matioCpp::Vector<T>::index_type currentSize = size();
+    if (newSize == currentSize)
+    {
+        return;
+    }
+
+    if (!reallocateVector(grownCapacity(newSize)))
+    {
+        assert(false && "Failed to resize.");
+        return;
+    }
+
+    if (newSize > currentSize)
+    {
+        memset(data() + currentSize, 0, (newSize - currentSize) * sizeof(typename matioCpp::Vector<T>::element_type));
+    }
+
+    setVectorSize(newSize);
+}
+
+template<typename T>
+bool matioCpp::Vector<T>::push_back(const typename matioCpp::Vector<T>::element_type& value)
+{
+    typename matioCpp::Vector<T>::value_type valueCopy = value; //The value may be an element of this vector, and the data may be reallocated
+    typename matioCpp::Vector<T>::index_type currentSize = size();
+
+    if (!reallocateVector(grownCapacity(currentSize + 1)))
     {
-        std::vector<typename matioCpp::Vector<T>::element_type> newVector(newSize);
-        memcpy(newVector.data(), data(), std::min(newSize, size()) * sizeof(typename matioCpp::Vector<T>::element_type));
-        this->operator=(newVector);
+        std::cerr << "[ERROR][matioCpp::Vector::push_back] Failed to add an element to " << name() << "." << std::endl;
+        return false;
     }
+
+    data()[currentSize] = valueCopy;
+    setVectorSize(currentSize + 1);
+
+    return true;
+}
+
+template<typename T>
+bool matioCpp::Vector<T>::append(Span<const typename matioCpp::Vector<T>::element_type> values)
+{
+    if (values.size() == 0)
+    {
+        return true;
+    }
+
+    typename matioCpp::Vector<T>::index_type currentSize = size();
+    typename matioCpp::Vector<T>::index_type newSize = currentSize + static_cast<typename matioCpp::Vector<T>::index_type>(values.size());
+
+    //If the values are part of this vector, they are moved together with the data
+    std::less<const typename matioCpp::Vector<T>::element_type*> before;
+    const typename matioCpp::Vector<T>::element_type* oldData = data();
+    bool isInternal = oldData && !before(values.data(), oldData) && before(values.data(), oldData + capacity());
+    ptrdiff_t offset = isInternal ? values.data() - oldData : 0;
+
+    if (!reallocateVector(grownCapacity(newSize)))
+    {
+        std::cerr << "[ERROR][matioCpp::Vector::append] Failed to add " << values.size() << " elements to " << name() << "." << std::endl;
+        return false;
+    }
+
+    const typename matioCpp::Vector<T>::element_type* source = isInternal ? data() + offset : values.data();
+    memmove(data() + currentSize, source, values.size() * sizeof(typename matioCpp::Vector<T>::element_type));
+    setVectorSize(newSize);
+
+    return true;
 }
 
 template<typename T>
@@ -285,25 +432,27 @@ void matioCpp::Vector<T>::clear()
 template<typename T>
 typename matioCpp::Vector<T>::pointer matioCpp::Vector<T>::data()
 {
-    return static_cast<typename matioCpp::Vector<T>::pointer>(toMatio()->data);
+    return static_cast<typename matioCpp::Vector<T>::pointer>(cachedData());
 }
 
 template<typename T>
 typename matioCpp::Vector<T>::const_pointer matioCpp::Vector<T>::data() const
 {
-    return static_cast<typename matioCpp::Vector<T>::const_pointer>(toMatio()->data);
+    return static_cast<typename matioCpp::Vector<T>::const_pointer>(cachedData());
 }
 
 template<typename T>
 typename matioCpp::Vector<T>::reference matioCpp::Vector<T>::operator()(typename matioCpp::Vector<T>::index_type el)
 {
-    return toSpan()(el);
+    assert(el < size() && "[matioCpp::Vector::operator()] The required element is out of bounds.");
+    return data()[el];
 }
 
 template<typename T>
 typename matioCpp::Vector<T>::value_type matioCpp::Vector<T>::operator()(typename matioCpp::Vector<T>::index_type el) const
 {
-    return toSpan()(el);
+    assert(el < size() && "[matioCpp::Vector::operator()] The required element is out of bounds.");
+    return data()[el];
 }
 
 template<typename T>
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/AsyncFileWriter.h>
+#include <matioCpp/SharedMatvar.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class matioCpp::AsyncFileWriter::Impl
+{
+public:
+
+    struct Request
+    {
+        matioCpp::Variable variable;
+        matioCpp::Compression compression;
+        std::promise<bool> promise;
+    };
+
+    matioCpp::File file;
+    size_t maxQueueSize{0};
+    matioCpp::QueueFullPolicy policy{matioCpp::QueueFullPolicy::Block};
+
+    mutable std::mutex mutex;
+    std::condition_variable requestAvailable; // Notified when a request is queued or the writer is closing
+    std::condition_variable spaceAvailable; // Notified when a request is taken from the queue
+    std::condition_variable idle; // Notified when the queue is empty and no request is being written
+    std::deque<Request> queue;
+    bool writing{false};
+    bool closing{false};
+    bool open{false};
+    size_t failedSinceFlush{0};
+    size_t dropped{0};
+    std::thread thread;
+
+    matioCpp::File releaseFile()
+    {
+        // A moved-from File cannot be used, hence it is replaced with an empty one
+        matioCpp::File output(std::move(file));
+        file = matioCpp::File();
+        return output;
+    }
+
+    static std::future<bool> failedFuture()
+    {
+        std::promise<bool> promise;
+        promise.set_value(false);
+        return promise.get_future();
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            requestAvailable.wait(lock, [this](){return closing || !queue.empty();});
+
+            if (queue.empty())
+            {
+                break; // Closing, and all the requests have been served
+            }
+
+            Request request(std::move(queue.front()));
+            queue.pop_front();
+            writing = true;
+            spaceAvailable.notify_one();
+            lock.unlock();
+
+            bool ok = file.write(request.variable, request.compression);
+            request.promise.set_value(ok);
+
+            lock.lock();
+            writing = false;
+            if (!ok)
+            {
+                failedSinceFlush++;
+            }
+            if (queue.empty())
+            {
+                idle.notify_all();
+            }
+        }
+    }
+
+    std::future<bool> push(matioCpp::Variable&& variable, matioCpp::Compression compression)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        if (!open)
+        {
+            std::cerr << "[ERROR][matioCpp::AsyncFileWriter::write] The writer is closed." << std::endl;
+            return failedFuture();
+        }
+
+        if (queue.size() >= maxQueueSize)
+        {
+            switch (policy)
+            {
+            case matioCpp::QueueFullPolicy::Block:
+                spaceAvailable.wait(lock, [this](){return !open || queue.size() < maxQueueSize;});
+                if (!open)
+                {
+                    std::cerr << "[ERROR][matioCpp::AsyncFileWriter::write] The writer has been closed while waiting." << std::endl;
+                    return failedFuture();
+                }
+                break;
+            case matioCpp::QueueFullPolicy::Drop:
+                dropped++;
+                failedSinceFlush++;
+                return failedFuture();
+            case matioCpp::QueueFullPolicy::Grow:
+                break;
+            }
+        }
+
+        queue.push_back(Request{std::move(variable), compression, std::promise<bool>()});
+        std::future<bool> output = queue.back().promise.get_future();
+        requestAvailable.notify_one();
+        return output;
+    }
+};
+
+matioCpp::AsyncFileWriter::AsyncFileWriter(matioCpp::File &&file, size_t maxQueueSize, matioCpp::QueueFullPolicy policy)
+    : m_pimpl(std::make_unique<Impl>())
+{
+    m_pimpl->file = std::move(file);
+    m_pimpl->maxQueueSize = std::max(maxQueueSize, static_cast<size_t>(1));
+    m_pimpl->policy = policy;
+
+    if (!m_pimpl->file.isOpen() || m_pimpl->file.mode() != matioCpp::FileMode::ReadAndWrite)
+    {
+        std::cerr << "[ERROR][matioCpp::AsyncFileWriter::AsyncFileWriter] The input file is not open in ReadAndWrite mode." << std::endl;
+        return;
+    }
+
+    m_pimpl->open = true;
+    m_pimpl->thread = std::thread(&Impl::run, m_pimpl.get());
+}
+
+matioCpp::AsyncFileWriter::~AsyncFileWriter()
+{
+    close();
+}
+
+std::future<bool> matioCpp::AsyncFileWriter::write(const matioCpp::Variable &variable, matioCpp::Compression compression)
+{
+    if (!variable.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::AsyncFileWriter::write] The input variable is not valid." << std::endl;
+        return Impl::failedFuture();
+    }
+
+    return m_pimpl->push(matioCpp::Variable(variable), compression);
+}
+
+std::future<bool> matioCpp::AsyncFileWriter::write(matioCpp::Variable &&variable, matioCpp::Compression compression)
+{
+    if (!variable.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::AsyncFileWriter::write] The input variable is not valid." << std::endl;
+        return Impl::failedFuture();
+    }
+
+    // The variable is queued as it is only if it is the only owner of its data. Otherwise, it may be a view
+    // of a variable owned by the caller (e.g. a field of a struct), which could be modified or destroyed while writing.
+    matvar_t* released = matioCpp::Variable::releaseMatvar(variable);
+    if (!released)
+    {
+        return m_pimpl->push(matioCpp::Variable(variable), compression);
+    }
+
+    return m_pimpl->push(matioCpp::Variable(matioCpp::SharedMatvar(released)), compression);
+}
+
+bool matioCpp::AsyncFileWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(m_pimpl->mutex);
+    m_pimpl->idle.wait(lock, [this](){return m_pimpl->queue.empty() && !m_pimpl->writing;});
+    bool ok = m_pimpl->failedSinceFlush == 0;
+    m_pimpl->failedSinceFlush = 0;
+    return ok;
+}
+
+matioCpp::File matioCpp::AsyncFileWriter::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pimpl->mutex);
+        if (!m_pimpl->open)
+        {
+            // The file is given back also if it has been rejected by the constructor
+            return m_pimpl->releaseFile();
+        }
+        m_pimpl->open = false;
+        m_pimpl->closing = true;
+    }
+    m_pimpl->requestAvailable.notify_one();
+    m_pimpl->spaceAvailable.notify_all();
+    m_pimpl->thread.join();
+
+    return m_pimpl->releaseFile();
+}
+
+bool matioCpp::AsyncFileWriter::isOpen() const
+{
+    std::lock_guard<std::mutex> lock(m_pimpl->mutex);
+    return m_pimpl->open;
+}
+
+size_t matioCpp::AsyncFileWriter::queueSize() const
+{
+    std::lock_guard<std::mutex> lock(m_pimpl->mutex);
+    return m_pimpl->queue.size();
+}
+
+size_t matioCpp::AsyncFileWriter::droppedWrites() const
+{
+    std::lock_guard<std::mutex> lock(m_pimpl->mutex);
+    return m_pimpl->dropped;
+}
@@ -89,6 +89,57 @@ matioCpp::CellArray::CellArray(const std::string &name, const std::vector<matioC
                        vectorOfPointers.data());
 }
 
+matioCpp::CellArray::CellArray(const std::string &name, const std::vector<matioCpp::CellArray::index_type> &dimensions, std::vector<matioCpp::Variable> &&elements)
+{
+    matioCpp::CellArray::index_type totalElements = 1;
+    for (matioCpp::CellArray::index_type dim : dimensions)
+    {
+        totalElements *= dim;
+    }
+
+    bool validElements = (totalElements == elements.size());
+    if (!validElements)
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::CellArray] The size of elements vector does not match the provided dimensions. The total number is different." << std::endl;
+    }
+
+    //Check all the elements before moving any of them
+    for (size_t i = 0; (i < totalElements) && validElements; ++i)
+    {
+        if (!elements[i].isValid())
+        {
+            std::cerr << "[ERROR][matioCpp::CellArray::CellArray] The element at index "<< i << " (0-based) is not valid." << std::endl;
+            validElements = false;
+        }
+    }
+
+    if (!validElements)
+    {
+        assert(false);
+        size_t emptyDimensions[] = {0, 0};
+        initializeVariable(name,
+                           VariableType::CellArray,
+                           matioCpp::ValueType::VARIABLE, emptyDimensions,
+                           nullptr);
+        return;
+    }
+
+    std::vector<matvar_t*> vectorOfPointers(totalElements, nullptr);
+    for (size_t i = 0; i < totalElements; ++i)
+    {
+        vectorOfPointers[i] = releaseMatvar(elements[i]);
+        if (!vectorOfPointers[i])
+        {
+            vectorOfPointers[i] = matioCpp::MatvarHandler::GetMatvarDuplicate(elements[i].toMatio());
+        }
+    }
+
+    initializeVariable(name,
+                       VariableType::CellArray,
+                       matioCpp::ValueType::VARIABLE, dimensions,
+                       vectorOfPointers.data());
+}
+
 matioCpp::CellArray::CellArray(const CellArray &other)
 {
     fromOther(other);
@@ -160,20 +211,61 @@ bool matioCpp::CellArray::fromVectorOfVariables(const std::vector<matioCpp::Cell
                               vectorOfPointers.data());
 }
 
+bool matioCpp::CellArray::fromVectorOfVariables(const std::vector<matioCpp::CellArray::index_type> &dimensions, std::vector<matioCpp::Variable> &&elements)
+{
+    matioCpp::CellArray::index_type totalElements = 1;
+    for (matioCpp::CellArray::index_type dim : dimensions)
+    {
+        totalElements *= dim;
+    }
+
+    if (totalElements != elements.size())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::fromVectorOfVariables] The size of elements vector does not match the provided dimensions. The total number is different." << std::endl;
+        return false;
+    }
+
+    //Check all the elements before moving any of them
+    for (size_t i = 0; i < totalElements; ++i)
+    {
+        if (!elements[i].isValid())
+        {
+            std::cerr << "[ERROR][matioCpp::CellArray::fromVectorOfVariables] The element at index "<< i << " (0-based) is not valid." << std::endl;
+            return false;
+        }
+    }
+
+    std::vector<matvar_t*> vectorOfPointers(totalElements, nullptr);
+    for (size_t i = 0; i < totalElements; ++i)
+    {
+        vectorOfPointers[i] = releaseMatvar(elements[i]);
+        if (!vectorOfPointers[i])
+        {
+            vectorOfPointers[i] = matioCpp::MatvarHandler::GetMatvarDuplicate(elements[i].toMatio());
+        }
+    }
+
+    return initializeVariable(name(),
+                              VariableType::CellArray,
+                              matioCpp::ValueType::VARIABLE, dimensions,
+                              vectorOfPointers.data());
+}
+
 typename matioCpp::CellArray::index_type matioCpp::CellArray::rawIndexFromIndices(const std::vector<typename matioCpp::CellArray::index_type> &el) const
 {
-    assert(dimensions().size() > 0 && numberOfElements() > 0 && "[matioCpp::CellArray::rawIndexFromIndices] The array is empty.");
-    assert(el.size() > 0 == dimensions().size() > 0 && "[matioCpp::CellArray::rawIndexFromIndices] The input vector el should have the same number of dimensions of the array.");
-    assert(el[0] < dimensions()[0] && "[matioCpp::CellArray::rawIndexFromIndices] The required element is out of bounds.");
+    matioCpp::Span<const size_t> dims = dimensions();
+    assert(dims.size() > 0 && numberOfElements() > 0 && "[matioCpp::CellArray::rawIndexFromIndices] The array is empty.");
+    assert(el.size() > 0 == dims.size() > 0 && "[matioCpp::CellArray::rawIndexFromIndices] The input vector el should have the same number of dimensions of the array.");
+    assert(el[0] < dims[0] && "[matioCpp::CellArray::rawIndexFromIndices] The required element is out of bounds.");
 
     typename matioCpp::CellArray::index_type index = 0;
     typename matioCpp::CellArray::index_type previousDimensionsFactorial = 1;
 
     for (size_t i = 0; i < el.size(); ++i)
     {
-        assert(el[i] < dimensions()[i] && "[matioCpp::CellArray::rawIndexFromIndices] The required element is out of bounds.");
+        assert(el[i] < dims[i] && "[matioCpp::CellArray::rawIndexFromIndices] The required element is out of bounds.");
         index += el[i] * previousDimensionsFactorial;
-        previousDimensionsFactorial *= dimensions()[i];
+        previousDimensionsFactorial *= dims[i];
     }
 
     return index;
@@ -181,7 +273,8 @@ typename matioCpp::CellArray::index_type matioCpp::CellArray::rawIndexFromIndice
 
 bool matioCpp::CellArray::indicesFromRawIndex(size_t rawIndex, std::vector<matioCpp::CellArray::index_type> &el) const
 {
-    el.resize(dimensions().size());
+    matioCpp::Span<const size_t> dims = dimensions();
+    el.resize(dims.size());
 
     if (rawIndex >= numberOfElements())
     {
@@ -189,14 +282,14 @@ bool matioCpp::CellArray::indicesFromRawIndex(size_t rawIndex, std::vector<matio
         return false;
     }
 
-    size_t previousDimensionsFactorial = dimensions()[0];
+    size_t previousDimensionsFactorial = dims[0];
 
     //First we fill el with the factorial of the dimensions
 
     for (size_t i = 1; i < el.size(); ++i)
     {
         el[i - 1] = previousDimensionsFactorial;
-        previousDimensionsFactorial *= dimensions()[i];
+        previousDimensionsFactorial *= dims[i];
     }
 
     size_t remainder = rawIndex;
@@ -211,6 +304,11 @@ bool matioCpp::CellArray::indicesFromRawIndex(size_t rawIndex, std::vector<matio
     return true;
 }
 
+matioCpp::MultiIndexRange matioCpp::CellArray::indices() const
+{
+    return matioCpp::MultiIndexRange(dimensions());
+}
+
 bool matioCpp::CellArray::setName(const std::string &newName)
 {
     return changeName(newName);
@@ -218,8 +316,167 @@ bool matioCpp::CellArray::setName(const std::string &newName)
 
 void matioCpp::CellArray::resize(const std::vector<typename matioCpp::CellArray::index_type> &newDimensions)
 {
-    matioCpp::CellArray newArray(name(), newDimensions);
-    fromOther(std::move(newArray));
+    for (matioCpp::CellArray::index_type dim : newDimensions)
+    {
+        if (dim == 0)
+        {
+            std::cerr << "[ERROR][matioCpp::CellArray::resize] Zero dimension detected." << std::endl;
+            assert(false);
+            return;
+        }
+    }
+
+    bool ok = resizeArray(newDimensions);
+    matioCpp::unused(ok);
+    assert(ok && "Failed to resize.");
+}
+
+bool matioCpp::CellArray::push_back(const matioCpp::Variable &newValue)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] The CellArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!newValue.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] The input variable is not valid." << std::endl;
+        return false;
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::CellArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(1))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] Failed to add an element to the cell array." << std::endl;
+        return false;
+    }
+
+    if (!setCellElement(position, newValue))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] Failed to set the cell element." << std::endl;
+        resizeArray(previousDimensions);
+        return false;
+    }
+
+    return true;
+}
+
+bool matioCpp::CellArray::push_back(matioCpp::Variable &&newValue)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] The CellArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!newValue.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] The input variable is not valid." << std::endl;
+        return false;
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::CellArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(1))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] Failed to add an element to the cell array." << std::endl;
+        return false;
+    }
+
+    if (!setCellElement(position, std::move(newValue)))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::push_back] Failed to set the cell element." << std::endl;
+        resizeArray(previousDimensions);
+        return false;
+    }
+
+    return true;
+}
+
+bool matioCpp::CellArray::append(const std::vector<matioCpp::Variable> &newValues)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::append] The CellArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        if (!newValues[i].isValid())
+        {
+            std::cerr << "[ERROR][matioCpp::CellArray::append] The element at index "<< i << " (0-based) is not valid." << std::endl;
+            return false;
+        }
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::CellArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(newValues.size()))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::append] Failed to add the elements to the cell array." << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        if (!setCellElement(position + i, newValues[i]))
+        {
+            std::cerr << "[ERROR][matioCpp::CellArray::append] Failed to set the element at index "<< i << " (0-based)." << std::endl;
+            resizeArray(previousDimensions);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool matioCpp::CellArray::append(std::vector<matioCpp::Variable> &&newValues)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::append] The CellArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        if (!newValues[i].isValid())
+        {
+            std::cerr << "[ERROR][matioCpp::CellArray::append] The element at index "<< i << " (0-based) is not valid." << std::endl;
+            return false;
+        }
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::CellArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(newValues.size()))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::append] Failed to add the elements to the cell array." << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        if (!setCellElement(position + i, std::move(newValues[i])))
+        {
+            std::cerr << "[ERROR][matioCpp::CellArray::append] Failed to set the element at index "<< i << " (0-based)." << std::endl;
+            resizeArray(previousDimensions);
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void matioCpp::CellArray::clear()
@@ -280,6 +537,54 @@ bool matioCpp::CellArray::setElement(matioCpp::CellArray::index_type el, const m
     return true;
 }
 
+bool matioCpp::CellArray::setElement(const std::vector<matioCpp::CellArray::index_type> &el, matioCpp::Variable &&newValue)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::setElement] The CellArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!newValue.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::setElement] The input variable is not valid." << std::endl;
+        return false;
+    }
+
+    if (!setCellElement(rawIndexFromIndices(el), std::move(newValue)))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::setElement] Failed to set the cell element." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool matioCpp::CellArray::setElement(matioCpp::CellArray::index_type el, matioCpp::Variable &&newValue)
+{
+    assert(el < numberOfElements() && "[matioCpp::CellArray::setElement] The required element is out of bounds.");
+
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::setElement] The CellArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!newValue.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::setElement] The input variable is not valid." << std::endl;
+        return false;
+    }
+
+    if (!setCellElement(el, std::move(newValue)))
+    {
+        std::cerr << "[ERROR][matioCpp::CellArray::setElement] Failed to set the cell element." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 matioCpp::Variable matioCpp::CellArray::operator()(const std::vector<matioCpp::CellArray::index_type> &el)
 {
     return getCellElement(rawIndexFromIndices(el));
@@ -324,3 +629,26 @@ const matioCpp::Variable matioCpp::CellArray::operator[](matioCpp::CellArray::in
     return getCellElement(el);
 }
 
+matioCpp::Variable matioCpp::CellArray::operator()(const matioCpp::MultiIndex &el)
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::CellArray::operator()] The required element is out of bounds.");
+    return getCellElement(el.rawIndex());
+}
+
+const matioCpp::Variable matioCpp::CellArray::operator()(const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::CellArray::operator()] The required element is out of bounds.");
+    return getCellElement(el.rawIndex());
+}
+
+matioCpp::Variable matioCpp::CellArray::operator[](const matioCpp::MultiIndex &el)
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::CellArray::operator[]] The required element is out of bounds.");
+    return getCellElement(el.rawIndex());
+}
+
+const matioCpp::Variable matioCpp::CellArray::operator[](const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::CellArray::operator[]] The required element is out of bounds.");
+    return getCellElement(el.rawIndex());
+}
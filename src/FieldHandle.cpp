@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/FieldHandle.h>
+#include <matioCpp/StructArray.h>
+
+matioCpp::FieldHandle::FieldHandle(const matioCpp::StructArray &array, const std::string &field)
+    : m_name(field)
+{
+    if (!array.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::FieldHandle::FieldHandle] The input array is not valid." << std::endl;
+        return;
+    }
+
+    m_index = array.getFieldIndex(field);
+    m_valid = m_index < array.numberOfFields();
+    m_array = array.toMatio();
+}
+
+bool matioCpp::FieldHandle::isValid() const
+{
+    return m_valid;
+}
+
+const std::string &matioCpp::FieldHandle::name() const
+{
+    return m_name;
+}
+
+size_t matioCpp::FieldHandle::index() const
+{
+    return m_index;
+}
+
+bool matioCpp::FieldHandle::isValidFor(const matioCpp::StructArray &array) const
+{
+    if (!m_valid || !array.isValid() || (array.toMatio() != m_array) || (m_index >= array.numberOfFields()))
+    {
+        return false;
+    }
+
+    char * const * fields = Mat_VarGetStructFieldnames(array.toMatio());
+    return fields && (m_name == fields[m_index]);
+}
@@ -10,83 +10,1142 @@
 #include <matioCpp/File.h>
 #include <time.h>
 #include <matioCpp/Config.h>
+#include <matioCpp/Statistics.h>
 #include <sys/types.h> //To check if the directory in which we want to create a new file exists
 #include <sys/stat.h> //To check if the directory in which we want to create a new file exists
+#include <atomic>
+#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <unordered_set>
+#include <random>
+#include <sstream>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h> //To map the file in memory
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+class matioCpp::File::Impl
+{
+public:
+
+    struct AppendableVariable
+    {
+        matioCpp::ValueType valueType;
+        matio_classes matioClass;
+        matio_types matioType;
+        int options{0};
+        size_t elementSize{0};
+        size_t columns{0};
+        size_t chunkRows{0};
+        matio_compression compression{matio_compression::MAT_COMPRESSION_NONE};
+        std::vector<char> buffer; // Row-major, chunkRows x columns
+        std::vector<char> columnMajorBuffer;
+        size_t bufferedRows{0};
+    };
+
+    mat_t* mat_ptr{nullptr};
+    matioCpp::FileMode fileMode{matioCpp::FileMode::ReadOnly};
+    std::unordered_map<std::string, AppendableVariable> appendables;
+
+    // Directory index. The variables are stored by name together with their position in the file.
+    bool indexBuilt{false};
+    std::vector<std::string> indexedNames;
+    std::unordered_map<std::string, size_t> nameToPosition;
+
+    // Position of the next variable returned by Mat_VarReadNext. Valid only if cursorValid is true.
+    size_t cursor{0};
+    bool cursorValid{false};
+
+    // True if something has been written since the file has been opened.
+    // Other handles to the same file may not see the written data until the file is closed.
+    bool hasWritten{false};
+
+    // Read-only view of the whole file in memory. It is shared with the variables returned by readMapped.
+    class MappedFile
+    {
+    public:
+        char* data{nullptr};
+        size_t size{0};
+#ifdef _WIN32
+        HANDLE fileHandle{INVALID_HANDLE_VALUE};
+        HANDLE mappingHandle{NULL};
+#endif
+
+        MappedFile() = default;
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+
+        bool map(const std::string& fileName)
+        {
+            // The pages are mapped copy-on-write. They are shared with the other processes mapping the same file
+            // until they are modified, and the modifications never reach the file.
+#ifdef _WIN32
+            fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                                     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            LARGE_INTEGER fileSize;
+            if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+            {
+                return false;
+            }
+            size = static_cast<size_t>(fileSize.QuadPart);
+            mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+            if (mappingHandle == NULL)
+            {
+                return false;
+            }
+            data = static_cast<char*>(MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0));
+            return data != nullptr;
+#else
+            int fd = ::open(fileName.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                return false;
+            }
+            struct stat fileStat;
+            if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+            {
+                ::close(fd);
+                return false;
+            }
+            size = static_cast<size_t>(fileStat.st_size);
+            void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            ::close(fd); // The mapping remains valid after closing the descriptor
+            if (address == MAP_FAILED)
+            {
+                return false;
+            }
+            data = static_cast<char*>(address);
+            return true;
+#endif
+        }
+
+        ~MappedFile()
+        {
+#ifdef _WIN32
+            if (data)
+            {
+                UnmapViewOfFile(data);
+            }
+            if (mappingHandle != NULL)
+            {
+                CloseHandle(mappingHandle);
+            }
+            if (fileHandle != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(fileHandle);
+            }
+#else
+            if (data)
+            {
+                munmap(data, size);
+            }
+#endif
+        }
+    };
+
+    std::shared_ptr<MappedFile> mappedFile;
+
+    void close()
+    {
+        fileMode = matioCpp::FileMode::ReadOnly;
+        freePtr();
+    }
+
+    void freePtr()
+    {
+        if (mat_ptr)
+        {
+            flushAppendables();
+            appendables.clear();
+            Mat_Close(mat_ptr);
+            mat_ptr = nullptr;
+        }
+        clearIndex();
+        hasWritten = false;
+        mappedFile.reset();
+    }
+
+    void clearIndex()
+    {
+        indexBuilt = false;
+        indexedNames.clear();
+        nameToPosition.clear();
+        cursorValid = false;
+    }
+
+    void buildIndex()
+    {
+        if (indexBuilt || !mat_ptr)
+        {
+            return;
+        }
+
+        size_t list_size = 0;
+        char* const* list = Mat_GetDir(mat_ptr, &list_size);
+
+        indexedNames.clear();
+        nameToPosition.clear();
+        indexedNames.reserve(list_size);
+        nameToPosition.reserve(list_size);
+        for (size_t i = 0; i < list_size; ++i)
+        {
+            addToIndex(list ? list[i] : nullptr);
+        }
+
+        indexBuilt = true;
+        cursorValid = false; // Mat_GetDir may have moved the file position
+    }
+
+    void addToIndex(const char* name)
+    {
+        // Unnamed variables are kept to preserve the positions of the following ones.
+        std::string variableName = name ? name : "";
+        if (variableName.size() && nameToPosition.find(variableName) == nameToPosition.end())
+        {
+            nameToPosition[variableName] = indexedNames.size();
+        }
+        indexedNames.push_back(variableName);
+    }
+
+    matvar_t* readVariable(const std::string& name)
+    {
+        // In MAT 7.3 files, matio accesses the variables directly by name.
+        if (Mat_GetVersion(mat_ptr) == mat_ft::MAT_FT_MAT73)
+        {
+            matioCpp::Statistics::ScopedOperation statistics(matioCpp::Statistics::Operation::FileRead);
+            matvar_t* output = Mat_VarRead(mat_ptr, name.c_str());
+            if (output)
+            {
+                statistics.addVariable(output);
+            }
+            return output;
+        }
+
+        // In the other versions, Mat_VarRead scans the variable headers from the beginning of the file.
+        // Since matio does not expose the file offsets, the index is used to move the cursor forward from
+        // the last read variable, skipping only the headers in between. Reading the variables in the order
+        // in which they are stored in the file thus requires a single pass.
+        buildIndex();
+
+        auto positionIt = nameToPosition.find(name);
+        if (positionIt == nameToPosition.end())
+        {
+            return nullptr;
+        }
+
+        return readAtPosition(mat_ptr, name, positionIt->second, cursor, cursorValid);
+    }
+
+    static matvar_t* readAtPosition(mat_t* matPtr, const std::string& name, size_t position, size_t& cursor, bool& cursorValid)
+    {
+        matioCpp::Statistics::ScopedOperation statistics(matioCpp::Statistics::Operation::FileRead);
+
+        if (!cursorValid || cursor > position)
+        {
+            Mat_Rewind(matPtr);
+            cursor = 0;
+            cursorValid = true;
+        }
+
+        while (cursor < position)
+        {
+            matvar_t* skipped = Mat_VarReadNextInfo(matPtr);
+            if (!skipped)
+            {
+                break;
+            }
+            Mat_VarFree(skipped);
+            cursor++;
+        }
+
+        if (cursor == position)
+        {
+            matvar_t* output = Mat_VarReadNext(matPtr);
+            if (output && output->name && (name == output->name))
+            {
+                cursor++;
+                statistics.addVariable(output);
+                return output;
+            }
+            Mat_VarFree(output);
+        }
+
+        // The file content is not consistent with the index, fall back to matio.
+        cursorValid = false;
+        matvar_t* output = Mat_VarRead(matPtr, name.c_str());
+        if (output)
+        {
+            statistics.addVariable(output);
+        }
+        return output;
+    }
+
+    void reset(mat_t* newPtr, matioCpp::FileMode mode)
+    {
+        freePtr();
+        mat_ptr = newPtr;
+        fileMode = mode;
+
+        if (!newPtr)
+        {
+            fileMode = matioCpp::FileMode::ReadOnly;
+        }
+    }
+
+    Impl()
+    { }
+
+    ~Impl()
+    {
+        close();
+    }
+
+    bool flushAppendable(const std::string& name, AppendableVariable& appendable)
+    {
+        if (appendable.bufferedRows == 0)
+        {
+            return true;
+        }
+
+        const size_t rows = appendable.bufferedRows;
+        const size_t columns = appendable.columns;
+        const size_t elementSize = appendable.elementSize;
+
+        // The rows are buffered row-major, while matio expects column-major data.
+        appendable.columnMajorBuffer.resize(rows * columns * elementSize);
+        for (size_t r = 0; r < rows; ++r)
+        {
+            for (size_t c = 0; c < columns; ++c)
+            {
+                std::memcpy(appendable.columnMajorBuffer.data() + (c * rows + r) * elementSize,
+                            appendable.buffer.data() + (r * columns + c) * elementSize,
+                            elementSize);
+            }
+        }
+
+#if MATIO_VERSION >= 1513
+        size_t dims[2] = {rows, columns};
+        matvar_t* chunk = Mat_VarCreate(name.c_str(), appendable.matioClass, appendable.matioType, 2, dims,
+                                        appendable.columnMajorBuffer.data(), appendable.options | MAT_F_DONT_COPY_DATA);
+
+        if (!chunk)
+        {
+            std::cerr << "[ERROR][matioCpp::File::flush] Failed to create the chunk of the variable " << name << "." << std::endl;
+            return false;
+        }
+
+        bool success = Mat_VarWriteAppend(mat_ptr, chunk, appendable.compression, 1) == 0;
+        Mat_VarFree(chunk);
+        cursorValid = false;
+        hasWritten = true;
+
+        if (success && indexBuilt && nameToPosition.find(name) == nameToPosition.end())
+        {
+            addToIndex(name.c_str());
+        }
+
+        if (!success)
+        {
+            std::cerr << "[ERROR][matioCpp::File::flush] Failed to append the buffered rows to the variable " << name << "." << std::endl;
+            return false;
+        }
+
+        appendable.bufferedRows = 0;
+        return true;
+#else
+        std::cerr << "[ERROR][matioCpp::File::flush] Appending to a variable is available only with matio >= 1.5.13." << std::endl;
+        return false;
+#endif
+    }
+
+    bool flushAppendables()
+    {
+        bool success = true;
+        for (auto& appendable : appendables)
+        {
+            success = flushAppendable(appendable.first, appendable.second) && success;
+        }
+        return success;
+    }
+
+    bool getSlabValueType(const matvar_t* info, matioCpp::ValueType& valueType)
+    {
+        if (info->isComplex || info->class_type == matio_classes::MAT_C_SPARSE)
+        {
+            return false;
+        }
+
+        switch (info->class_type)
+        {
+        case matio_classes::MAT_C_INT8:
+            valueType = matioCpp::ValueType::INT8;
+            break;
+        case matio_classes::MAT_C_UINT8:
+            valueType = info->isLogical ? matioCpp::ValueType::LOGICAL : matioCpp::ValueType::UINT8;
+            break;
+        case matio_classes::MAT_C_INT16:
+            valueType = matioCpp::ValueType::INT16;
+            break;
+        case matio_classes::MAT_C_UINT16:
+            valueType = matioCpp::ValueType::UINT16;
+            break;
+        case matio_classes::MAT_C_INT32:
+            valueType = matioCpp::ValueType::INT32;
+            break;
+        case matio_classes::MAT_C_UINT32:
+            valueType = matioCpp::ValueType::UINT32;
+            break;
+        case matio_classes::MAT_C_SINGLE:
+            valueType = matioCpp::ValueType::SINGLE;
+            break;
+        case matio_classes::MAT_C_DOUBLE:
+            valueType = matioCpp::ValueType::DOUBLE;
+            break;
+        case matio_classes::MAT_C_INT64:
+            valueType = matioCpp::ValueType::INT64;
+            break;
+        case matio_classes::MAT_C_UINT64:
+            valueType = matioCpp::ValueType::UINT64;
+            break;
+        default:
+            return false;
+        }
+
+        return true;
+    }
+
+    matioCpp::Variable readSlab(const std::string& name, const std::vector<size_t>& start,
+                                const std::vector<size_t>& stride, const std::vector<size_t>& count, bool linear)
+    {
+        std::string errorPrefix = linear ? "[ERROR][matioCpp::File::readLinear] " : "[ERROR][matioCpp::File::read] ";
+        matioCpp::Statistics::ScopedOperation statistics(matioCpp::Statistics::Operation::FileRead);
+
+        cursorValid = false;
+        matvar_t* info = Mat_VarReadInfo(mat_ptr, name.c_str());
+        if (!info)
+        {
+            std::cerr << errorPrefix << "The variable " << name << " does not exist." << std::endl;
+            return matioCpp::Variable();
+        }
+
+        SharedMatvar infoHandler(info); // Frees the info when going out of scope
+
+        matioCpp::ValueType valueType;
+        if (!getSlabValueType(info, valueType))
+        {
+            std::cerr << errorPrefix << "The variable " << name << " is not a real numeric or logical variable." << std::endl;
+            return matioCpp::Variable();
+        }
+
+        size_t rank = linear ? 1 : static_cast<size_t>(info->rank);
+        std::vector<size_t> inputDimensions;
+        if (linear)
+        {
+            inputDimensions.push_back(1);
+            for (int i = 0; i < info->rank; ++i)
+            {
+                inputDimensions[0] *= info->dims[i];
+            }
+        }
+        else
+        {
+            inputDimensions.assign(info->dims, info->dims + info->rank);
+        }
+
+        if (start.size() != rank || stride.size() != rank || count.size() != rank)
+        {
+            std::cerr << errorPrefix << "The start, stride and count vectors are expected to have " << rank
+                      << " elements, like the number of dimensions of " << name << "." << std::endl;
+            return matioCpp::Variable();
+        }
+
+        std::vector<int> matioStart(rank), matioStride(rank), matioEdge(rank);
+        size_t totalElements = 1;
+        for (size_t i = 0; i < rank; ++i)
+        {
+            if (count[i] == 0 || stride[i] == 0)
+            {
+                std::cerr << errorPrefix << "The stride and count have to be greater than zero." << std::endl;
+                return matioCpp::Variable();
+            }
+
+            if (start[i] + (count[i] - 1) * stride[i] >= inputDimensions[i])
+            {
+                std::cerr << errorPrefix << "The requested elements exceed the dimension " << i
+                          << " of the variable " << name << " (size " << inputDimensions[i] << ")." << std::endl;
+                return matioCpp::Variable();
+            }
+
+            if (inputDimensions[i] > static_cast<size_t>(std::numeric_limits<int>::max()))
+            {
+                std::cerr << errorPrefix << "The dimension " << i << " of the variable " << name
+                          << " is too large to be read partially." << std::endl;
+                return matioCpp::Variable();
+            }
+
+            matioStart[i] = static_cast<int>(start[i]);
+            matioStride[i] = static_cast<int>(stride[i]);
+            matioEdge[i] = static_cast<int>(count[i]);
+            totalElements *= count[i];
+        }
+
+        matio_classes outputClass;
+        matio_types outputType;
+        get_matio_types(matioCpp::VariableType::MultiDimensionalArray, valueType, outputClass, outputType);
+
+        auto buffer = std::make_shared<std::vector<char>>(totalElements * Mat_SizeOf(outputType));
+
+        int err = linear ? Mat_VarReadDataLinear(mat_ptr, info, buffer->data(), matioStart[0], matioStride[0], matioEdge[0])
+                         : Mat_VarReadData(mat_ptr, info, buffer->data(), matioStart.data(), matioStride.data(), matioEdge.data());
+
+        if (err != 0)
+        {
+            std::cerr << errorPrefix << "Failed to read the requested elements of the variable " << name << "." << std::endl;
+            return matioCpp::Variable();
+        }
+
+        std::vector<size_t> outputDimensions = count;
+        if (linear)
+        {
+            outputDimensions.push_back(1);
+        }
+
+        int options = MAT_F_DONT_COPY_DATA;
+        if (valueType == matioCpp::ValueType::LOGICAL)
+        {
+            options |= MAT_F_LOGICAL;
+        }
+
+        matvar_t* slab = Mat_VarCreate(name.c_str(), outputClass, outputType, static_cast<int>(outputDimensions.size()),
+                                       outputDimensions.data(), buffer->data(), options);
+
+        statistics.addData(buffer->size(), 1);
+
+        // The output owns the buffer, which is released together with the matvar.
+        return matioCpp::Variable(matioCpp::SharedMatvar(slab, matioCpp::DeleteMode::ShallowDelete, buffer));
+    }
+
+    static size_t estimateBytes(const matvar_t* input)
+    {
+        size_t numberOfElements = 1;
+        for (int i = 0; i < input->rank; ++i)
+        {
+            numberOfElements *= input->dims[i];
+        }
+
+        if (input->class_type == matio_classes::MAT_C_CELL || input->class_type == matio_classes::MAT_C_STRUCT)
+        {
+            size_t numberOfChildren = numberOfElements;
+            if (input->class_type == matio_classes::MAT_C_STRUCT)
+            {
+                numberOfChildren *= Mat_VarGetNumberOfFields(const_cast<matvar_t*>(input));
+            }
+
+            size_t output = numberOfChildren * sizeof(matvar_t*);
+            matvar_t* const* children = static_cast<matvar_t* const*>(input->data);
+            for (size_t i = 0; children && i < numberOfChildren; ++i)
+            {
+                if (children[i])
+                {
+                    output += sizeof(matvar_t) + estimateBytes(children[i]);
+                }
+            }
+            return output;
+        }
+
+        if (input->class_type == matio_classes::MAT_C_SPARSE)
+        {
+            return input->nbytes; // The number of non-zero elements is not known without reading the data
+        }
+
+        return numberOfElements * Mat_SizeOfClass(input->class_type) * (input->isComplex ? 2 : 1);
+    }
+
+    static void fillInfo(const matvar_t* input, matioCpp::VariableInfo& output)
+    {
+        // When reading only the header, the data type may not be available yet.
+        matvar_t header = *input;
+        if (header.data_type == matio_types::MAT_T_UNKNOWN || header.data_type == matio_types::MAT_T_COMPRESSED)
+        {
+            switch (header.class_type)
+            {
+            case matio_classes::MAT_C_CELL:
+                header.data_type = matio_types::MAT_T_CELL;
+                break;
+            case matio_classes::MAT_C_STRUCT:
+                header.data_type = matio_types::MAT_T_STRUCT;
+                break;
+            case matio_classes::MAT_C_CHAR:
+                header.data_type = matio_types::MAT_T_UTF8;
+                break;
+            case matio_classes::MAT_C_DOUBLE:
+                header.data_type = matio_types::MAT_T_DOUBLE;
+                break;
+            case matio_classes::MAT_C_SINGLE:
+                header.data_type = matio_types::MAT_T_SINGLE;
+                break;
+            case matio_classes::MAT_C_INT8:
+                header.data_type = matio_types::MAT_T_INT8;
+                break;
+            case matio_classes::MAT_C_UINT8:
+                header.data_type = matio_types::MAT_T_UINT8;
+                break;
+            case matio_classes::MAT_C_INT16:
+                header.data_type = matio_types::MAT_T_INT16;
+                break;
+            case matio_classes::MAT_C_UINT16:
+                header.data_type = matio_types::MAT_T_UINT16;
+                break;
+            case matio_classes::MAT_C_INT32:
+                header.data_type = matio_types::MAT_T_INT32;
+                break;
+            case matio_classes::MAT_C_UINT32:
+                header.data_type = matio_types::MAT_T_UINT32;
+                break;
+            case matio_classes::MAT_C_INT64:
+                header.data_type = matio_types::MAT_T_INT64;
+                break;
+            case matio_classes::MAT_C_UINT64:
+                header.data_type = matio_types::MAT_T_UINT64;
+                break;
+            default:
+                break;
+            }
+        }
+
+        output.valid = get_types_from_matvart(&header, output.variableType, output.valueType);
+        output.name = input->name ? input->name : "";
+        output.dimensions.assign(input->dims, input->dims + input->rank);
+        output.isComplex = input->isComplex;
+        output.estimatedBytes = estimateBytes(input);
+        output.children.clear();
+
+        matvar_t* const* children = static_cast<matvar_t* const*>(input->data);
+        if (!children)
+        {
+            return;
+        }
+
+        size_t numberOfChildren = 0;
+        if (input->class_type == matio_classes::MAT_C_CELL)
+        {
+            numberOfChildren = output.numberOfElements();
+        }
+        else if (input->class_type == matio_classes::MAT_C_STRUCT && output.numberOfElements() > 0)
+        {
+            numberOfChildren = Mat_VarGetNumberOfFields(const_cast<matvar_t*>(input)); //Only the fields of the first element
+        }
+
+        output.children.resize(numberOfChildren);
+        for (size_t i = 0; i < numberOfChildren; ++i)
+        {
+            if (children[i])
+            {
+                fillInfo(children[i], output.children[i]);
+            }
+        }
+    }
+
+    std::string isVariableNameValid(const std::string& inputName)
+    {
+        if (inputName.size() == 0)
+        {
+            return std::string("The input variable has an empty name.");
+        }
+
+        if (inputName.size() > 63)
+        {
+            return std::string("The input variable name is too long (maximum 63 char allowed)."); // Many Matlab versions have this limitation
+        }
+
+        if (!isalpha(inputName[0]))
+        {
+            return std::string("The first character of the variable name has to be a letter (Variable name = " + inputName + ").");
+        }
+
+        for (size_t i = 1; i < inputName.size(); ++i)
+        {
+            if (!isalnum(inputName[i]) && (inputName[i] != '_'))
+            {
+                return std::string("The variable name can contain only alphanumeric characters or underscores (Variable name = \"" + inputName + "\").");
+            }
+        }
+
+        return std::string(); //Empty string, no error
+    }
+
+    std::string isVariableValid(const matioCpp::Variable& input)
+    {
+        if (!input.isValid())
+        {
+            return "The input variable is not valid.";
+        }
+
+        return isVariableNameValid(input.name());
+    }
+
+    static uint32_t readUint32(const char* address)
+    {
+        uint32_t output;
+        memcpy(&output, address, sizeof(uint32_t));
+        return output;
+    }
+
+    static bool getMappedDataType(matio_classes classType, bool logical, matio_types& dataType, matioCpp::ValueType& valueType)
+    {
+        // The data is mapped only if it is stored with the type corresponding to the class of the variable
+        switch (classType)
+        {
+        case matio_classes::MAT_C_DOUBLE:
+            dataType = matio_types::MAT_T_DOUBLE;
+            valueType = matioCpp::ValueType::DOUBLE;
+            break;
+        case matio_classes::MAT_C_SINGLE:
+            dataType = matio_types::MAT_T_SINGLE;
+            valueType = matioCpp::ValueType::SINGLE;
+            break;
+        case matio_classes::MAT_C_INT8:
+            dataType = matio_types::MAT_T_INT8;
+            valueType = matioCpp::ValueType::INT8;
+            break;
+        case matio_classes::MAT_C_UINT8:
+            dataType = matio_types::MAT_T_UINT8;
+            valueType = logical ? matioCpp::ValueType::LOGICAL : matioCpp::ValueType::UINT8;
+            break;
+        case matio_classes::MAT_C_INT16:
+            dataType = matio_types::MAT_T_INT16;
+            valueType = matioCpp::ValueType::INT16;
+            break;
+        case matio_classes::MAT_C_UINT16:
+            dataType = matio_types::MAT_T_UINT16;
+            valueType = matioCpp::ValueType::UINT16;
+            break;
+        case matio_classes::MAT_C_INT32:
+            dataType = matio_types::MAT_T_INT32;
+            valueType = matioCpp::ValueType::INT32;
+            break;
+        case matio_classes::MAT_C_UINT32:
+            dataType = matio_types::MAT_T_UINT32;
+            valueType = matioCpp::ValueType::UINT32;
+            break;
+        case matio_classes::MAT_C_INT64:
+            dataType = matio_types::MAT_T_INT64;
+            valueType = matioCpp::ValueType::INT64;
+            break;
+        case matio_classes::MAT_C_UINT64:
+            dataType = matio_types::MAT_T_UINT64;
+            valueType = matioCpp::ValueType::UINT64;
+            break;
+        default:
+            return false;
+        }
 
-class matioCpp::File::Impl
-{
-public:
-    mat_t* mat_ptr{nullptr};
-    matioCpp::FileMode fileMode{matioCpp::FileMode::ReadOnly};
+        return true;
+    }
 
-    void close()
+    matioCpp::Variable readMapped(const std::string& name)
     {
-        fileMode = matioCpp::FileMode::ReadOnly;
-        freePtr();
+        const std::string errorPrefix = "[ERROR][matioCpp::File::readMapped] ";
+
+        if (Mat_GetVersion(mat_ptr) != MAT_FT_MAT5)
+        {
+            std::cerr << errorPrefix << "Only MAT5 files can be mapped. Use read instead." << std::endl;
+            return matioCpp::Variable();
+        }
+
+        if (hasWritten)
+        {
+            std::cerr << errorPrefix << "The file has been written since it has been opened. Close and open it again before mapping it." << std::endl;
+            return matioCpp::Variable();
+        }
+
+        if (!mappedFile)
+        {
+            auto newMapping = std::make_shared<MappedFile>();
+            if (!newMapping->map(Mat_GetFilename(mat_ptr)) || newMapping->size < 128)
+            {
+                std::cerr << errorPrefix << "Failed to map the file " << Mat_GetFilename(mat_ptr) << " in memory." << std::endl;
+                return matioCpp::Variable();
+            }
+            mappedFile = newMapping;
+        }
+
+        const char* data = mappedFile->data;
+        size_t size = mappedFile->size;
+
+        // The last two bytes of the header are 'I' and 'M' if the file has been written with the same endianness
+        uint16_t endianIndicator;
+        memcpy(&endianIndicator, data + 126, sizeof(uint16_t));
+        if (endianIndicator != (('M' << 8) | 'I'))
+        {
+            std::cerr << errorPrefix << "The file has been written with a different endianness. Use read instead." << std::endl;
+            return matioCpp::Variable();
+        }
+
+        const uint32_t miINT32 = 5, miUINT32 = 6, miINT8 = 1, miMATRIX = 14;
+        const uint32_t complexFlag = 0x0800, logicalFlag = 0x0200;
+
+        // Reads a data element tag, taking into account the small data element format
+        auto readTag = [data, size](size_t offset, uint32_t& type, size_t& bytes, size_t& dataOffset, size_t& next)
+        {
+            if (offset + 8 > size)
+            {
+                return false;
+            }
+            type = readUint32(data + offset);
+            if ((type >> 16) != 0)
+            {
+                bytes = type >> 16;
+                type &= 0xFFFF;
+                dataOffset = offset + 4;
+                next = offset + 8;
+                return bytes <= 4;
+            }
+            bytes = readUint32(data + offset + 4);
+            dataOffset = offset + 8;
+            next = dataOffset + ((bytes + 7) / 8) * 8;
+            return (bytes <= size) && (dataOffset <= size - bytes);
+        };
+
+        size_t offset = 128;
+        while (offset + 8 <= size)
+        {
+            uint32_t type = readUint32(data + offset);
+            size_t elementBytes = readUint32(data + offset + 4);
+            size_t elementEnd = offset + 8 + elementBytes;
+            if (elementEnd > size)
+            {
+                break;
+            }
+
+            if (type != miMATRIX || elementBytes == 0)
+            {
+                offset = elementEnd;
+                continue;
+            }
+
+            uint32_t subType;
+            size_t flagsBytes, flagsOffset, dimensionsStart, dimensionsBytes, dimensionsOffset, nameStart, nameBytes, nameOffset, realStart;
+            if (!readTag(offset + 8, subType, flagsBytes, flagsOffset, dimensionsStart) || subType != miUINT32 || flagsBytes < 8 ||
+                !readTag(dimensionsStart, subType, dimensionsBytes, dimensionsOffset, nameStart) || subType != miINT32 ||
+                !readTag(nameStart, subType, nameBytes, nameOffset, realStart) || subType != miINT8)
+            {
+                offset = elementEnd;
+                continue;
+            }
+
+            if (name != std::string(data + nameOffset, nameBytes))
+            {
+                offset = elementEnd;
+                continue;
+            }
+
+            uint32_t flags = readUint32(data + flagsOffset);
+            matio_classes classType = static_cast<matio_classes>(flags & 0xFF);
+            matio_types expectedDataType;
+            matioCpp::ValueType valueType;
+            if (!getMappedDataType(classType, (flags & logicalFlag) != 0, expectedDataType, valueType))
+            {
+                std::cerr << errorPrefix << "The variable " << name << " is not a numeric or logical array. Use read instead." << std::endl;
+                return matioCpp::Variable();
+            }
+
+            if ((flags & complexFlag) != 0)
+            {
+                std::cerr << errorPrefix << "The variable " << name << " is complex. Use read instead." << std::endl;
+                return matioCpp::Variable();
+            }
+
+            std::vector<size_t> dimensions(dimensionsBytes / 4);
+            size_t numberOfElements = 1;
+            for (size_t i = 0; i < dimensions.size(); ++i)
+            {
+                dimensions[i] = static_cast<size_t>(readUint32(data + dimensionsOffset + 4 * i));
+                numberOfElements *= dimensions[i];
+            }
+
+            uint32_t dataType = 0;
+            size_t dataBytes = 0, dataOffset = 0, dataEnd = 0;
+            if (numberOfElements > 0 && (!readTag(realStart, dataType, dataBytes, dataOffset, dataEnd) ||
+                                         dataType != static_cast<uint32_t>(expectedDataType) ||
+                                         dataBytes != numberOfElements * Mat_SizeOf(expectedDataType)))
+            {
+                std::cerr << errorPrefix << "The data of the variable " << name << " is not stored with the type of its class. Use read instead." << std::endl;
+                return matioCpp::Variable();
+            }
+
+            matio_classes outputClass;
+            matio_types outputType;
+            get_matio_types(matioCpp::VariableType::MultiDimensionalArray, valueType, outputClass, outputType);
+
+            int options = MAT_F_DONT_COPY_DATA;
+            if (valueType == matioCpp::ValueType::LOGICAL)
+            {
+                options |= MAT_F_LOGICAL;
+            }
+
+            void* variableData = (numberOfElements > 0) ? mappedFile->data + dataOffset : nullptr;
+            matvar_t* mapped = Mat_VarCreate(name.c_str(), outputClass, outputType, static_cast<int>(dimensions.size()),
+                                             dimensions.data(), variableData, options);
+
+            // The output keeps the file mapped until it is destroyed.
+            return matioCpp::Variable(matioCpp::SharedMatvar(mapped, matioCpp::DeleteMode::ShallowDelete, mappedFile));
+        }
+
+        buildIndex();
+        if (nameToPosition.find(name) != nameToPosition.end())
+        {
+            std::cerr << errorPrefix << "The variable " << name << " is compressed. Use read instead." << std::endl;
+        }
+        else
+        {
+            std::cerr << errorPrefix << "The variable " << name << " does not exist." << std::endl;
+        }
+        return matioCpp::Variable();
     }
 
-    void freePtr()
+    enum class BatchWriteResult
     {
-        if (mat_ptr)
+        Written,
+        NotWritten,
+        Failed
+    };
+
+    // Below this size, spawning the threads and merging the temporary files costs more than compressing sequentially
+    static constexpr size_t parallelCompressionMinimumBytes = 1 << 20;
+
+    static size_t payloadBytes(const matvar_t* variable)
+    {
+        if (!variable)
         {
-            Mat_Close(mat_ptr);
-            mat_ptr = nullptr;
+            return 0;
+        }
+
+        if (((variable->class_type == matio_classes::MAT_C_STRUCT) || (variable->class_type == matio_classes::MAT_C_CELL))
+            && variable->data)
+        {
+            size_t bytes = 0;
+            matvar_t* const* elements = static_cast<matvar_t* const*>(variable->data);
+            for (size_t i = 0; i < variable->nbytes / sizeof(matvar_t*); ++i)
+            {
+                bytes += payloadBytes(elements[i]);
+            }
+            return bytes;
         }
+
+        return variable->nbytes;
     }
 
-    void reset(mat_t* newPtr, matioCpp::FileMode mode)
+    static bool sameHeaderFormat(const std::string& firstFile, const std::string& secondFile)
     {
-        freePtr();
-        mat_ptr = newPtr;
-        fileMode = mode;
+        // Bytes 124-127 of a MAT5 header contain the version and the endian indicator
+        char firstHeader[128], secondHeader[128];
+        FILE* first = fopen(firstFile.c_str(), "rb");
+        FILE* second = fopen(secondFile.c_str(), "rb");
+        bool ok = first && second
+                && (fread(firstHeader, 1, 128, first) == 128)
+                && (fread(secondHeader, 1, 128, second) == 128)
+                && (memcmp(firstHeader + 124, secondHeader + 124, 4) == 0);
+        if (first)
+        {
+            fclose(first);
+        }
+        if (second)
+        {
+            fclose(second);
+        }
+        return ok;
+    }
 
-        if (!newPtr)
+    static bool getFileSize(const std::string& fileName, long long& size)
+    {
+        struct stat info;
+        if (stat(fileName.c_str(), &info) != 0)
         {
-            fileMode = matioCpp::FileMode::ReadOnly;
+            return false;
         }
+        size = static_cast<long long>(info.st_size);
+        return true;
     }
 
-    Impl()
-    { }
+    static bool fileExists(const std::string& fileName)
+    {
+        struct stat info;
+        return stat(fileName.c_str(), &info) == 0;
+    }
 
-    ~Impl()
+    static bool truncateFile(const std::string& fileName, long long size)
     {
-        close();
+#ifdef _WIN32
+        HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        LARGE_INTEGER position;
+        position.QuadPart = size;
+        bool ok = SetFilePointerEx(fileHandle, position, NULL, FILE_BEGIN) && SetEndOfFile(fileHandle);
+        CloseHandle(fileHandle);
+        return ok;
+#else
+        return truncate(fileName.c_str(), static_cast<off_t>(size)) == 0;
+#endif
     }
 
-    std::string isVariableValid(const matioCpp::Variable& input)
+    static std::string uniqueTemporaryPrefix(const std::string& fileName)
     {
-        if (!input.isValid())
+        // The process id and a random suffix avoid clashes with other processes and with existing files
+        std::random_device randomDevice;
+        std::ostringstream prefix;
+#ifdef _WIN32
+        prefix << fileName << ".matioCpp." << GetCurrentProcessId() << ".";
+#else
+        prefix << fileName << ".matioCpp." << getpid() << ".";
+#endif
+        prefix << std::hex << randomDevice() << randomDevice() << ".";
+        return prefix.str();
+    }
+
+    static bool appendFileContent(FILE* destination, const std::string& sourceFile, long offset)
+    {
+        FILE* source = fopen(sourceFile.c_str(), "rb");
+        if (!source)
         {
-            return "The input variable is not valid.";
+            return false;
+        }
+
+        bool ok = fseek(source, offset, SEEK_SET) == 0;
+        std::vector<char> block(1 << 20);
+        while (ok)
+        {
+            size_t readBytes = fread(block.data(), 1, block.size(), source);
+            if (readBytes == 0)
+            {
+                ok = !ferror(source);
+                break;
+            }
+            ok = fwrite(block.data(), 1, readBytes, destination) == readBytes;
         }
+        fclose(source);
+        return ok;
+    }
 
-        const std::string& inputName = input.name();
+    BatchWriteResult writeCompressedInParallel(const std::vector<const matioCpp::Variable*>& variables, size_t threads)
+    {
+        // matio can only serialize a variable to a file. Each worker compresses a contiguous slice of the
+        // batch in a temporary MAT5 file. Since a MAT5 file is a header followed by a sequence of data
+        // elements, the temporary files are then appended to the original one, skipping their header.
+        std::string fileName = Mat_GetFilename(mat_ptr);
+        matioCpp::FileMode mode = fileMode;
+        std::vector<std::string> tempFiles(threads);
+        std::vector<char> workerSuccess(threads, 0);
+        std::vector<std::thread> workers;
+
+        auto worker = [&](size_t t)
+        {
+            size_t begin = t * variables.size() / threads;
+            size_t end = (t + 1) * variables.size() / threads;
+            mat_t* tempFile = Mat_CreateVer(tempFiles[t].c_str(), NULL, MAT_FT_MAT5);
+            if (!tempFile)
+            {
+                return;
+            }
 
-        if (inputName.size() == 0)
+            bool ok = true;
+            for (size_t i = begin; (i < end) && ok; ++i)
+            {
+                SharedMatvar shallowCopy = SharedMatvar::GetMatvarShallowDuplicate(variables[i]->toMatio());
+                ok = Mat_VarWrite(tempFile, shallowCopy.get(), MAT_COMPRESSION_ZLIB) == 0;
+            }
+            Mat_Close(tempFile);
+            workerSuccess[t] = ok;
+        };
+
+        std::string tempPrefix = uniqueTemporaryPrefix(fileName);
+        for (size_t t = 0; t < threads; ++t)
         {
-            return std::string("The input variable has an empty name.");
+            tempFiles[t] = tempPrefix + std::to_string(t) + ".tmp";
+            if (fileExists(tempFiles[t]))
+            {
+                // Never overwrite, and then delete, a file that does not belong to this batch
+                return BatchWriteResult::NotWritten;
+            }
         }
 
-        if (inputName.size() > 63)
+        for (size_t t = 1; t < threads; ++t)
         {
-            return std::string("The input variable name is too long (maximum 63 char allowed)."); // Many Matlab versions have this limitation
+            workers.emplace_back(worker, t);
         }
+        worker(0);
 
-        if (!isalpha(inputName[0]))
+        for (std::thread& w : workers)
         {
-            return std::string("The first character of the variable name has to be a letter (Variable name = " + inputName + ").");
+            w.join();
         }
 
-        for (size_t i = 1; i < inputName.size(); ++i)
+        auto removeTempFiles = [&tempFiles]()
         {
-            if (!isalnum(inputName[i]) && (inputName[i] != '_'))
+            for (const std::string& tempFile : tempFiles)
             {
-                return std::string("The variable name can contain only alphanumeric characters or underscores (Variable name = \"" + inputName + "\").");
+                remove(tempFile.c_str());
+            }
+        };
+
+        for (char success : workerSuccess)
+        {
+            if (!success)
+            {
+                removeTempFiles();
+                return BatchWriteResult::NotWritten;
             }
         }
 
-        return std::string(); //Empty string, no error
+        freePtr();
+
+        if (!sameHeaderFormat(fileName, tempFiles.front()))
+        {
+            removeTempFiles();
+            reset(Mat_Open(fileName.c_str(), MAT_ACC_RDWR), mode);
+            return mat_ptr ? BatchWriteResult::NotWritten : BatchWriteResult::Failed;
+        }
+
+        long long originalSize = 0;
+        bool ok = getFileSize(fileName, originalSize);
+        FILE* output = ok ? fopen(fileName.c_str(), "ab") : nullptr;
+        if (output)
+        {
+            for (size_t t = 0; (t < threads) && ok; ++t)
+            {
+                ok = appendFileContent(output, tempFiles[t], 128);
+            }
+            ok = (fclose(output) == 0) && ok;
+
+            if (!ok && !truncateFile(fileName, originalSize))
+            {
+                std::cerr << "[ERROR][matioCpp::File::writeBatch] Failed to remove the partially appended variables from "
+                          << fileName << "." << std::endl;
+            }
+        }
+        else
+        {
+            ok = false;
+        }
+
+        removeTempFiles();
+        reset(Mat_Open(fileName.c_str(), MAT_ACC_RDWR), mode);
+
+        return (ok && mat_ptr) ? BatchWriteResult::Written : BatchWriteResult::Failed;
     }
 };
 
@@ -249,68 +1308,249 @@ std::string matioCpp::File::name() const
     return Mat_GetFilename(m_pimpl->mat_ptr);
 }
 
-std::string matioCpp::File::header() const
+std::string matioCpp::File::header() const
+{
+    if (!isOpen())
+    {
+        return "";
+    }
+
+#if MATIO_VERSION >= 1515
+    return Mat_GetHeader(m_pimpl->mat_ptr);
+#else
+    std::cerr << "[ERROR][matioCpp::File::header] The file header can be retrieved only with matio >= 1.5.15" << std::endl;
+    return "";
+#endif
+}
+
+matioCpp::FileVersion matioCpp::File::version() const
+{
+    if (!isOpen())
+    {
+        return matioCpp::FileVersion::Undefined;
+    }
+
+    switch (Mat_GetVersion(m_pimpl->mat_ptr))
+    {
+    case mat_ft::MAT_FT_MAT4:
+        return matioCpp::FileVersion::MAT4;
+
+    case mat_ft::MAT_FT_MAT5:
+        return matioCpp::FileVersion::MAT5;
+
+    case mat_ft::MAT_FT_MAT73:
+        return matioCpp::FileVersion::MAT7_3;
+
+    default:
+        return matioCpp::FileVersion::Undefined;
+    }
+}
+
+matioCpp::FileMode matioCpp::File::mode() const
+{
+    return m_pimpl->fileMode;
+}
+
+std::vector<std::string> matioCpp::File::variableNames() const
+{
+    std::vector<std::string> outputNames;
+    if (isOpen())
+    {
+        m_pimpl->buildIndex();
+
+        outputNames.reserve(m_pimpl->indexedNames.size());
+        for (const std::string& name : m_pimpl->indexedNames)
+        {
+            if (name.size())
+            {
+                outputNames.push_back(name);
+            }
+        }
+    }
+
+    return outputNames;
+}
+
+matioCpp::VariableInfo matioCpp::File::info(const std::string &name) const
+{
+    matioCpp::VariableInfo output;
+
+    if (!isOpen())
+    {
+        std::cerr << "[ERROR][matioCpp::File::info] The file is not open." <<std::endl;
+        return output;
+    }
+
+    m_pimpl->cursorValid = false;
+    matvar_t* header = Mat_VarReadInfo(m_pimpl->mat_ptr, name.c_str());
+
+    if (!header)
+    {
+        std::cerr << "[ERROR][matioCpp::File::info] The variable " << name << " does not exist." << std::endl;
+        return output;
+    }
+
+    Impl::fillInfo(header, output);
+    Mat_VarFree(header);
+
+    return output;
+}
+
+std::vector<matioCpp::VariableInfo> matioCpp::File::schema() const
+{
+    std::vector<matioCpp::VariableInfo> output;
+
+    if (!isOpen())
+    {
+        std::cerr << "[ERROR][matioCpp::File::schema] The file is not open." <<std::endl;
+        return output;
+    }
+
+    Mat_Rewind(m_pimpl->mat_ptr);
+
+    matvar_t* header = Mat_VarReadNextInfo(m_pimpl->mat_ptr);
+    while (header)
+    {
+        output.emplace_back();
+        Impl::fillInfo(header, output.back());
+        Mat_VarFree(header);
+        header = Mat_VarReadNextInfo(m_pimpl->mat_ptr);
+    }
+
+    Mat_Rewind(m_pimpl->mat_ptr);
+    m_pimpl->cursor = 0;
+    m_pimpl->cursorValid = true;
+
+    return output;
+}
+
+matioCpp::Variable matioCpp::File::read(const std::string &name) const
 {
     if (!isOpen())
     {
-        return "";
+        std::cerr << "[ERROR][matioCpp::File::read] The file is not open." <<std::endl;
+        return matioCpp::Variable();
     }
 
-#if MATIO_VERSION >= 1515
-    return Mat_GetHeader(m_pimpl->mat_ptr);
-#else
-    std::cerr << "[ERROR][matioCpp::File::header] The file header can be retrieved only with matio >= 1.5.15" << std::endl;
-    return "";
+#if defined(_MSC_VER) && MATIO_VERSION < 1519
+    if (version() == matioCpp::FileVersion::MAT7_3)
+    {
+        std::cerr << "[ERROR][matioCpp::File::read] Reading to a 7.3 file on Windows with a matio version previous to 1.5.19 causes segfaults. The output will be an invalid Variable." << std::endl;
+        return matioCpp::Variable();
+    }
 #endif
+
+    matvar_t *matVar = m_pimpl->readVariable(name);
+
+    matioCpp::Variable output((matioCpp::SharedMatvar(matVar)));
+
+    if (!output.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::File::read] Failed to read variable " << name << ". The output is not valid." <<std::endl;
+    }
+
+    return output;
 }
 
-matioCpp::FileVersion matioCpp::File::version() const
+std::vector<matioCpp::Variable> matioCpp::File::readMany(const std::vector<std::string> &names, size_t threads) const
 {
+    std::vector<matioCpp::Variable> output(names.size());
+
     if (!isOpen())
     {
-        return matioCpp::FileVersion::Undefined;
+        std::cerr << "[ERROR][matioCpp::File::readMany] The file is not open." <<std::endl;
+        return output;
     }
 
-    switch (Mat_GetVersion(m_pimpl->mat_ptr))
+    if (threads == 0)
     {
-    case mat_ft::MAT_FT_MAT4:
-        return matioCpp::FileVersion::MAT4;
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threads = std::min(threads, names.size());
 
-    case mat_ft::MAT_FT_MAT5:
-        return matioCpp::FileVersion::MAT5;
+    // HDF5 is usually not built thread-safe, hence MAT 7.3 files are read serially.
+    // The same happens if the file has been written, since other handles may not see the new data.
+    bool parallel = (threads > 1) && (version() != matioCpp::FileVersion::MAT7_3) && !m_pimpl->hasWritten;
 
-    case mat_ft::MAT_FT_MAT73:
-        return matioCpp::FileVersion::MAT7_3;
+    if (parallel)
+    {
+        m_pimpl->buildIndex();
 
-    default:
-        return matioCpp::FileVersion::Undefined;
-    }
-}
+        // The requests are sorted by position in the file, so that the cursor of each worker moves only forward.
+        std::vector<std::pair<size_t, size_t>> requests; // Position in the file, index in the output
+        requests.reserve(names.size());
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            auto positionIt = m_pimpl->nameToPosition.find(names[i]);
+            if (positionIt != m_pimpl->nameToPosition.end())
+            {
+                requests.emplace_back(positionIt->second, i);
+            }
+        }
+        std::sort(requests.begin(), requests.end());
 
-matioCpp::FileMode matioCpp::File::mode() const
-{
-    return m_pimpl->fileMode;
-}
+        std::vector<matvar_t*> results(names.size(), nullptr);
+        std::atomic<size_t> nextRequest{0};
+        std::string fileName = name();
 
-std::vector<std::string> matioCpp::File::variableNames() const
-{
-    std::vector<std::string> outputNames;
-    if (isOpen())
-    {
-        size_t list_size;
-        char* const* list = Mat_GetDir(m_pimpl->mat_ptr, &list_size);
+        auto worker = [&]()
+        {
+            mat_t* workerPtr = Mat_Open(fileName.c_str(), mat_acc::MAT_ACC_RDONLY);
+            if (!workerPtr)
+            {
+                return;
+            }
 
-        outputNames.resize(list_size);
-        for (size_t i = 0; i < list_size; ++i)
+            size_t cursor = 0;
+            bool cursorValid = false;
+            for (size_t r = nextRequest++; r < requests.size(); r = nextRequest++)
+            {
+                size_t outputIndex = requests[r].second;
+                results[outputIndex] = Impl::readAtPosition(workerPtr, names[outputIndex], requests[r].first, cursor, cursorValid);
+            }
+
+            Mat_Close(workerPtr);
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back(worker);
+        }
+
+        for (std::thread& workerThread : workers)
+        {
+            workerThread.join();
+        }
+
+        for (size_t i = 0; i < names.size(); ++i)
         {
-            outputNames[i] = list[i];
+            if (results[i])
+            {
+                output[i] = matioCpp::Variable(matioCpp::SharedMatvar(results[i]));
+            }
         }
     }
 
-    return outputNames;
+    // Serial read, also used for the variables that could not be read by the workers
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        if (!output[i].isValid())
+        {
+            matioCpp::Variable serialOutput = read(names[i]);
+            if (serialOutput.isValid())
+            {
+                output[i] = std::move(serialOutput);
+            }
+        }
+    }
+
+    return output;
 }
 
-matioCpp::Variable matioCpp::File::read(const std::string &name) const
+matioCpp::Variable matioCpp::File::read(const std::string &name, const std::vector<size_t> &start,
+                                        const std::vector<size_t> &stride, const std::vector<size_t> &count) const
 {
     if (!isOpen())
     {
@@ -326,16 +1566,37 @@ matioCpp::Variable matioCpp::File::read(const std::string &name) const
     }
 #endif
 
-    matvar_t *matVar = Mat_VarRead(m_pimpl->mat_ptr, name.c_str());
+    return m_pimpl->readSlab(name, start, stride, count, false);
+}
 
-    matioCpp::Variable output((matioCpp::SharedMatvar(matVar)));
+matioCpp::Variable matioCpp::File::readLinear(const std::string &name, size_t start, size_t stride, size_t count) const
+{
+    if (!isOpen())
+    {
+        std::cerr << "[ERROR][matioCpp::File::readLinear] The file is not open." <<std::endl;
+        return matioCpp::Variable();
+    }
 
-    if (!output.isValid())
+#if defined(_MSC_VER) && MATIO_VERSION < 1519
+    if (version() == matioCpp::FileVersion::MAT7_3)
     {
-        std::cerr << "[ERROR][matioCpp::File::read] Failed to read variable " << name << ". The output is not valid." <<std::endl;
+        std::cerr << "[ERROR][matioCpp::File::readLinear] Reading to a 7.3 file on Windows with a matio version previous to 1.5.19 causes segfaults. The output will be an invalid Variable." << std::endl;
+        return matioCpp::Variable();
     }
+#endif
 
-    return output;
+    return m_pimpl->readSlab(name, {start}, {stride}, {count}, true);
+}
+
+matioCpp::Variable matioCpp::File::readMapped(const std::string &name) const
+{
+    if (!isOpen())
+    {
+        std::cerr << "[ERROR][matioCpp::File::readMapped] The file is not open." <<std::endl;
+        return matioCpp::Variable();
+    }
+
+    return m_pimpl->readMapped(name);
 }
 
 bool matioCpp::File::write(const Variable &variable, Compression compression)
@@ -359,8 +1620,18 @@ bool matioCpp::File::write(const Variable &variable, Compression compression)
         return false;
     }
 
+    if (m_pimpl->appendables.find(variable.name()) != m_pimpl->appendables.end())
+    {
+        std::cerr << "[ERROR][matioCpp::File::write] The variable " << variable.name() << " is an appendable variable. Use appendRows instead." << std::endl;
+        return false;
+    }
+
     SharedMatvar shallowCopy = SharedMatvar::GetMatvarShallowDuplicate(variable.toMatio()); // Shallow copy to remove const
 
+    matioCpp::Statistics::ScopedOperation statistics((compression == matioCpp::Compression::zlib) ?
+                                                         matioCpp::Statistics::Operation::FileWriteCompressed :
+                                                         matioCpp::Statistics::Operation::FileWrite);
+
     matio_compression matioCompression =
             (compression == matioCpp::Compression::zlib) ? matio_compression::MAT_COMPRESSION_ZLIB : matio_compression::MAT_COMPRESSION_NONE;
 
@@ -396,6 +1667,8 @@ bool matioCpp::File::write(const Variable &variable, Compression compression)
     }
 
     bool success = Mat_VarWrite(m_pimpl->mat_ptr, shallowCopy.get(), matioCompression) == 0;
+    m_pimpl->cursorValid = false;
+    m_pimpl->hasWritten = true;
 
     if (!success)
     {
@@ -403,6 +1676,86 @@ bool matioCpp::File::write(const Variable &variable, Compression compression)
         return false;
     }
 
+    if (m_pimpl->indexBuilt)
+    {
+        m_pimpl->addToIndex(variable.name().c_str());
+    }
+
+    statistics.addVariable(variable.toMatio());
+
+    return true;
+}
+
+bool matioCpp::File::writeBatch(const std::vector<const Variable *> &variables, Compression compression)
+{
+    size_t threads = std::min(static_cast<size_t>(std::thread::hardware_concurrency()), variables.size());
+
+    bool parallel = (threads > 1) && (compression == matioCpp::Compression::zlib) && isOpen()
+            && (mode() == matioCpp::FileMode::ReadAndWrite) && (version() == matioCpp::FileVersion::MAT5)
+            && m_pimpl->appendables.empty();
+
+    if (parallel)
+    {
+        size_t totalBytes = 0;
+        for (const matioCpp::Variable* variable : variables)
+        {
+            totalBytes += Impl::payloadBytes(variable->toMatio());
+        }
+        parallel = totalBytes >= Impl::parallelCompressionMinimumBytes;
+    }
+
+    if (parallel)
+    {
+        // The whole batch is checked in advance, to avoid writing only part of it
+        m_pimpl->buildIndex();
+        std::unordered_set<std::string> batchNames;
+        for (const matioCpp::Variable* variable : variables)
+        {
+            if ((m_pimpl->isVariableValid(*variable).size() != 0) ||
+                (m_pimpl->nameToPosition.find(variable->name()) != m_pimpl->nameToPosition.end()) ||
+                !batchNames.insert(variable->name()).second)
+            {
+                parallel = false;
+                break;
+            }
+        }
+    }
+
+    if (parallel)
+    {
+        Impl::BatchWriteResult result;
+        {
+            matioCpp::Statistics::ScopedOperation statistics(matioCpp::Statistics::Operation::FileWriteCompressed);
+            result = m_pimpl->writeCompressedInParallel(variables, threads);
+            if (result == Impl::BatchWriteResult::Written)
+            {
+                for (const matioCpp::Variable* variable : variables)
+                {
+                    statistics.addVariable(variable->toMatio());
+                }
+            }
+        }
+
+        if (result == Impl::BatchWriteResult::Written)
+        {
+            return true;
+        }
+
+        if (result == Impl::BatchWriteResult::Failed)
+        {
+            std::cerr << "[ERROR][matioCpp::File::writeBatch] Failed to append the compressed variables to the file." <<std::endl;
+            return false;
+        }
+    }
+
+    for (const matioCpp::Variable* variable : variables)
+    {
+        if (!write(*variable, compression))
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -411,3 +1764,191 @@ bool matioCpp::File::isOpen() const
     return m_pimpl->mat_ptr;
 }
 
+
+bool matioCpp::File::createAppendable(const std::string &name, matioCpp::ValueType valueType, size_t columns,
+                                      size_t chunkRows, matioCpp::Compression compression)
+{
+    if (!isOpen())
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] The file is not open." <<std::endl;
+        return false;
+    }
+
+    if (mode() != matioCpp::FileMode::ReadAndWrite)
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] The file cannot be written." <<std::endl;
+        return false;
+    }
+
+    if (version() != matioCpp::FileVersion::MAT7_3)
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] Appendable variables are supported only by MAT7_3 files." <<std::endl;
+        return false;
+    }
+
+#if MATIO_VERSION < 1513
+    std::cerr << "[ERROR][matioCpp::File::createAppendable] Appendable variables are available only with matio >= 1.5.13." << std::endl;
+    return false;
+#endif
+
+    std::string error = m_pimpl->isVariableNameValid(name);
+    if (error.size() != 0)
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] " << error << std::endl;
+        return false;
+    }
+
+    if (columns == 0 || chunkRows == 0)
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] The number of columns and the chunk size have to be greater than zero." << std::endl;
+        return false;
+    }
+
+    if (m_pimpl->appendables.find(name) != m_pimpl->appendables.end())
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] The appendable variable " << name << " has already been created." << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> existingNames = variableNames();
+    if (std::find(existingNames.begin(), existingNames.end(), name) != existingNames.end())
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] A variable named " << name << " already exists in the file." << std::endl;
+        return false;
+    }
+
+    Impl::AppendableVariable appendable;
+
+    switch (valueType)
+    {
+    case matioCpp::ValueType::INT8:
+    case matioCpp::ValueType::UINT8:
+    case matioCpp::ValueType::INT16:
+    case matioCpp::ValueType::UINT16:
+    case matioCpp::ValueType::INT32:
+    case matioCpp::ValueType::UINT32:
+    case matioCpp::ValueType::SINGLE:
+    case matioCpp::ValueType::DOUBLE:
+    case matioCpp::ValueType::INT64:
+    case matioCpp::ValueType::UINT64:
+        break;
+    case matioCpp::ValueType::LOGICAL:
+        appendable.options = MAT_F_LOGICAL;
+        break;
+    default:
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] Only numeric and LOGICAL types are supported." << std::endl;
+        return false;
+    }
+
+    if (!get_matio_types(matioCpp::VariableType::MultiDimensionalArray, valueType, appendable.matioClass, appendable.matioType))
+    {
+        std::cerr << "[ERROR][matioCpp::File::createAppendable] Failed to convert the value type to matio types." << std::endl;
+        return false;
+    }
+
+    appendable.valueType = valueType;
+    appendable.elementSize = Mat_SizeOf(appendable.matioType);
+    appendable.columns = columns;
+    appendable.chunkRows = chunkRows;
+    appendable.compression = (compression == matioCpp::Compression::zlib) ? matio_compression::MAT_COMPRESSION_ZLIB : matio_compression::MAT_COMPRESSION_NONE;
+    appendable.buffer.resize(chunkRows * columns * appendable.elementSize);
+
+    m_pimpl->appendables.emplace(name, std::move(appendable));
+
+    return true;
+}
+
+bool matioCpp::File::appendRowsImpl(const std::string &name, const void *data, size_t numberOfElements, matioCpp::ValueType inputType)
+{
+    if (!isOpen())
+    {
+        std::cerr << "[ERROR][matioCpp::File::appendRows] The file is not open." <<std::endl;
+        return false;
+    }
+
+    auto appendableIt = m_pimpl->appendables.find(name);
+
+    if (appendableIt == m_pimpl->appendables.end())
+    {
+        std::cerr << "[ERROR][matioCpp::File::appendRows] No appendable variable named " << name << " has been created." << std::endl;
+        return false;
+    }
+
+    Impl::AppendableVariable& appendable = appendableIt->second;
+
+    bool sameType = (inputType == appendable.valueType) ||
+                    ((appendable.valueType == matioCpp::ValueType::LOGICAL) && (inputType == matioCpp::ValueType::UINT8));
+    if (!sameType)
+    {
+        std::cerr << "[ERROR][matioCpp::File::appendRows] The input type does not match the type of the variable " << name << "." << std::endl;
+        return false;
+    }
+
+    if (numberOfElements % appendable.columns != 0)
+    {
+        std::cerr << "[ERROR][matioCpp::File::appendRows] The number of input elements (" << numberOfElements
+                  << ") is not a multiple of the number of columns (" << appendable.columns << ")." << std::endl;
+        return false;
+    }
+
+    const char* input = static_cast<const char*>(data);
+    size_t rowsToAppend = numberOfElements / appendable.columns;
+    size_t rowSize = appendable.columns * appendable.elementSize;
+
+    while (rowsToAppend > 0)
+    {
+        if (appendable.bufferedRows == appendable.chunkRows)
+        {
+            if (!m_pimpl->flushAppendable(name, appendable))
+            {
+                return false;
+            }
+        }
+
+        size_t rowsInChunk = std::min(rowsToAppend, appendable.chunkRows - appendable.bufferedRows);
+        std::memcpy(appendable.buffer.data() + appendable.bufferedRows * rowSize, input, rowsInChunk * rowSize);
+        appendable.bufferedRows += rowsInChunk;
+        input += rowsInChunk * rowSize;
+        rowsToAppend -= rowsInChunk;
+    }
+
+    if (appendable.bufferedRows == appendable.chunkRows)
+    {
+        return m_pimpl->flushAppendable(name, appendable);
+    }
+
+    return true;
+}
+
+bool matioCpp::File::flush(const std::string &name)
+{
+    auto appendableIt = m_pimpl->appendables.find(name);
+
+    if (appendableIt == m_pimpl->appendables.end())
+    {
+        std::cerr << "[ERROR][matioCpp::File::flush] No appendable variable named " << name << " has been created." << std::endl;
+        return false;
+    }
+
+    return m_pimpl->flushAppendable(appendableIt->first, appendableIt->second);
+}
+
+bool matioCpp::File::flush()
+{
+    return m_pimpl->flushAppendables();
+}
+
+bool matioCpp::File::closeAppendable(const std::string &name)
+{
+    auto appendableIt = m_pimpl->appendables.find(name);
+
+    if (appendableIt == m_pimpl->appendables.end())
+    {
+        std::cerr << "[ERROR][matioCpp::File::closeAppendable] No appendable variable named " << name << " has been created." << std::endl;
+        return false;
+    }
+
+    bool success = m_pimpl->flushAppendable(appendableIt->first, appendableIt->second);
+    m_pimpl->appendables.erase(appendableIt);
+    return success;
+}
@@ -8,6 +8,35 @@
 #include <matioCpp/MatvarHandler.h>
 #include <matioCpp/SharedMatvar.h>
 #include <matioCpp/ConversionUtilities.h>
+#include <matioCpp/Statistics.h>
+#include <cstdlib>
+
+namespace
+{
+    constexpr size_t minimumFieldsForIndex = 16; //Smaller structs are searched linearly
+
+    bool findStructFieldLinearly(matvar_t* structPointer, const std::string& field, size_t& index)
+    {
+        size_t numberOfFields = Mat_VarGetNumberOfFields(structPointer);
+        char * const * fields = Mat_VarGetStructFieldnames(structPointer);
+        index = numberOfFields;
+
+        if (!fields)
+        {
+            return false;
+        }
+
+        size_t i = 0;
+        while (i < numberOfFields && (strcmp(fields[i], field.c_str()) != 0))
+        {
+            ++i;
+        }
+
+        index = i;
+
+        return index < numberOfFields;
+    }
+}
 
 matioCpp::MatvarHandler::PointerInfo::PointerInfo()
 {
@@ -17,9 +46,9 @@ matioCpp::MatvarHandler::PointerInfo::PointerInfo()
     m_valueType = matioCpp::ValueType::UNSUPPORTED;
 }
 
-matioCpp::MatvarHandler::PointerInfo::PointerInfo(matvar_t *ptr, DeleteMode deleteMode)
+matioCpp::MatvarHandler::PointerInfo::PointerInfo(matvar_t *ptr, DeleteMode deleteMode, std::shared_ptr<void> dataOwner)
 {
-    changePointer(ptr, deleteMode);
+    changePointer(ptr, deleteMode, dataOwner);
 }
 
 matioCpp::MatvarHandler::PointerInfo::~PointerInfo()
@@ -27,11 +56,13 @@ matioCpp::MatvarHandler::PointerInfo::~PointerInfo()
     //It does nothing by default. The ownership determines when to delete the pointer
 }
 
-void matioCpp::MatvarHandler::PointerInfo::changePointer(matvar_t *ptr, DeleteMode deleteMode)
+void matioCpp::MatvarHandler::PointerInfo::changePointer(matvar_t *ptr, DeleteMode deleteMode, std::shared_ptr<void> dataOwner)
 {
-    //The previous pointer is not deleted since it is the ownership triggering it
+    //The previous pointer is not deleted since it is the ownership triggering it.
+    //The ownership is also in charge of incrementing the generation.
     m_ptr = ptr;
     m_mode = deleteMode;
+    m_dataOwner = dataOwner;
     m_varType = matioCpp::VariableType::Unsupported;
     m_valueType = matioCpp::ValueType::UNSUPPORTED;
     get_types_from_matvart(m_ptr, m_varType, m_valueType);
@@ -41,6 +72,7 @@ void matioCpp::MatvarHandler::PointerInfo::deletePointer()
 {
     DeletePointer(m_ptr, m_mode);
     m_ptr = nullptr;
+    m_dataOwner.reset(); //The data can be released only after the pointer has been deleted
 }
 
 matvar_t *matioCpp::MatvarHandler::PointerInfo::pointer()
@@ -70,7 +102,7 @@ bool matioCpp::MatvarHandler::PointerInfo::operator!=(const matioCpp::MatvarHand
 
 void matioCpp::MatvarHandler::PointerInfo::DeletePointer(matvar_t *ptr, DeleteMode deleteMode)
 {
-    if (deleteMode == DeleteMode::Delete || deleteMode == DeleteMode::ShallowDelete)
+    if (ptr && (deleteMode == DeleteMode::Delete || deleteMode == DeleteMode::ShallowDelete))
     {
         if (deleteMode == DeleteMode::ShallowDelete)
         {
@@ -83,32 +115,105 @@ void matioCpp::MatvarHandler::PointerInfo::DeletePointer(matvar_t *ptr, DeleteMo
     }
 }
 
-void matioCpp::MatvarHandler::Ownership::dropDependencies(matvar_t *previouslyOwned)
+constexpr size_t matioCpp::MatvarHandler::NoDependency;
+
+size_t matioCpp::MatvarHandler::Ownership::homeSlot(const matvar_t *pointer) const
+{
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer) >> 4) * 0x9E3779B97F4A7C15ull; //Fibonacci hashing
+    return static_cast<size_t>(hash ^ (hash >> 32)) & (m_lookup.size() - 1);
+}
+
+size_t matioCpp::MatvarHandler::Ownership::findSlot(const matvar_t *pointer) const
 {
-    if (!previouslyOwned)
+    if (!pointer || m_lookup.empty())
     {
-        return;
+        return NoDependency;
     }
 
-    std::unordered_map<matvar_t*, Dependency>::iterator it = m_dependencyTree.find(previouslyOwned);
+    size_t mask = m_lookup.size() - 1;
+    for (size_t slot = homeSlot(pointer); m_lookup[slot] != NoDependency; slot = (slot + 1) & mask)
+    {
+        if (m_dependencyTree[m_lookup[slot]].pointer == pointer)
+        {
+            return slot;
+        }
+    }
+
+    return NoDependency;
+}
 
-    if (it == m_dependencyTree.end())
+void matioCpp::MatvarHandler::Ownership::insertInLookup(size_t node)
+{
+    if (2 * (m_numberOfDependencies + 1) > m_lookup.size()) //Keep the load factor below 0.5
     {
-        return;
+        std::vector<size_t> previous(std::max<size_t>(16, 2 * m_lookup.size()), NoDependency);
+        previous.swap(m_lookup);
+        for (size_t oldNode : previous)
+        {
+            if (oldNode != NoDependency)
+            {
+                size_t slot = homeSlot(m_dependencyTree[oldNode].pointer);
+                while (m_lookup[slot] != NoDependency)
+                {
+                    slot = (slot + 1) & (m_lookup.size() - 1);
+                }
+                m_lookup[slot] = oldNode;
+            }
+        }
     }
 
-    for (matvar_t* child : it->second.dependencies)
+    size_t slot = homeSlot(m_dependencyTree[node].pointer);
+    while (m_lookup[slot] != NoDependency)
+    {
+        slot = (slot + 1) & (m_lookup.size() - 1);
+    }
+    m_lookup[slot] = node;
+    m_numberOfDependencies++;
+}
+
+void matioCpp::MatvarHandler::Ownership::eraseFromLookup(size_t slot)
+{
+    size_t mask = m_lookup.size() - 1;
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask; m_lookup[next] != NoDependency; next = (next + 1) & mask)
     {
+        size_t home = homeSlot(m_dependencyTree[m_lookup[next]].pointer);
+        //The entry can fill the hole only if its home slot is not cyclically in (hole, next]
+        bool homeInRange = (hole <= next) ? ((home > hole) && (home <= next)) : ((home > hole) || (home <= next));
+        if (!homeInRange)
+        {
+            m_lookup[hole] = m_lookup[next];
+            hole = next;
+        }
+    }
+    m_lookup[hole] = NoDependency;
+    m_numberOfDependencies--;
+}
+
+void matioCpp::MatvarHandler::Ownership::dropDependencies(size_t node)
+{
+    size_t child = m_dependencyTree[node].firstChild;
+    while (child != NoDependency)
+    {
+        size_t next = m_dependencyTree[child].nextSibling;
         dropDependencies(child);
+        child = next;
     }
 
-    PointerInfo::DeletePointer(previouslyOwned, it->second.mode);
+    Dependency& dependency = m_dependencyTree[node];
+    PointerInfo::DeletePointer(dependency.pointer, dependency.mode);
+    invalidateStructFieldIndex(dependency.pointer);
 
-    m_dependencyTree.erase(previouslyOwned);
+    eraseFromLookup(findSlot(dependency.pointer));
+    dependency.pointer = nullptr;
+    dependency.firstChild = NoDependency;
+    dependency.nextSibling = m_firstFree;
+    m_firstFree = node;
 }
 
 matioCpp::MatvarHandler::Ownership::Ownership(std::weak_ptr<PointerInfo> pointerToDeallocate)
     : m_main(pointerToDeallocate)
+    , m_generation(std::make_shared<std::atomic<uint64_t>>(1))
 {
 
 }
@@ -120,27 +225,71 @@ matioCpp::MatvarHandler::Ownership::~Ownership()
 
 bool matioCpp::MatvarHandler::Ownership::isOwning(matvar_t *test)
 {
-    return (test && ((test == (m_main.lock()->pointer())) || (m_dependencyTree.find(test) != m_dependencyTree.end())));
+    if (!test)
+    {
+        return false;
+    }
+
+    std::shared_ptr<PointerInfo> locked = m_main.lock();
+    return (locked && (test == locked->pointer())) || (findSlot(test) != NoDependency);
 }
 
 void matioCpp::MatvarHandler::Ownership::own(matvar_t *owned, const matioCpp::MatvarHandler *owner, matioCpp::DeleteMode mode)
 {
     assert(owner);
-    if (owned)
+    if (!owned)
     {
-        Dependency dep;
-        dep.mode = mode;
-        if (*(owner->m_ptr) != *(m_main.lock()))
-        {
-            dep.parent = owner->m_ptr->pointer();
+        return;
+    }
 
-            assert(m_dependencyTree.find(dep.parent) != m_dependencyTree.end());
+    size_t existing = findSlot(owned);
+    if (existing != NoDependency)
+    {
+        //The same pointer can be accessed several times, e.g. when getting the same field more than once
+        m_dependencyTree[m_lookup[existing]].mode = mode;
+        return;
+    }
 
-            m_dependencyTree[dep.parent].dependencies.insert(owned);
-        }
+    size_t parent = NoDependency;
+    std::shared_ptr<PointerInfo> main = m_main.lock();
+    if (!main || (*(owner->m_ptr) != *main))
+    {
+        size_t parentSlot = findSlot(owner->m_ptr->pointer());
+        assert(parentSlot != NoDependency);
+        parent = (parentSlot != NoDependency) ? m_lookup[parentSlot] : NoDependency;
+    }
 
-        m_dependencyTree[owned] = dep;
+    size_t node = m_firstFree;
+    if (node != NoDependency)
+    {
+        m_firstFree = m_dependencyTree[node].nextSibling;
+    }
+    else
+    {
+        node = m_dependencyTree.size();
+        m_dependencyTree.emplace_back();
     }
+
+    Dependency& dependency = m_dependencyTree[node];
+    dependency.pointer = owned;
+    dependency.mode = mode;
+    dependency.parent = parent;
+    dependency.firstChild = NoDependency;
+    dependency.previousSibling = NoDependency;
+    dependency.nextSibling = NoDependency;
+
+    if (parent != NoDependency)
+    {
+        size_t sibling = m_dependencyTree[parent].firstChild;
+        dependency.nextSibling = sibling;
+        if (sibling != NoDependency)
+        {
+            m_dependencyTree[sibling].previousSibling = node;
+        }
+        m_dependencyTree[parent].firstChild = node;
+    }
+
+    insertInLookup(node);
 }
 
 void matioCpp::MatvarHandler::Ownership::drop(matvar_t *previouslyOwned)
@@ -150,39 +299,122 @@ void matioCpp::MatvarHandler::Ownership::drop(matvar_t *previouslyOwned)
         return;
     }
 
-    std::unordered_map<matvar_t*, Dependency>::iterator it = m_dependencyTree.find(previouslyOwned);
+    nextGeneration(); //The variables pointing to previouslyOwned are not valid anymore
+
+    size_t slot = findSlot(previouslyOwned);
 
-    if (it == m_dependencyTree.end())
+    if (slot == NoDependency)
     {
         return;
     }
 
-    std::unordered_map<matvar_t*, Dependency>::iterator parent = m_dependencyTree.find(it->second.parent);
+    size_t node = m_lookup[slot];
+    Dependency& dependency = m_dependencyTree[node];
 
-    if ((it->second.parent != m_main.lock()->pointer()) && (parent != m_dependencyTree.end()))
+    if (dependency.previousSibling != NoDependency)
+    {
+        m_dependencyTree[dependency.previousSibling].nextSibling = dependency.nextSibling;
+    }
+    else if (dependency.parent != NoDependency)
     {
-        parent->second.dependencies.erase(previouslyOwned);
+        m_dependencyTree[dependency.parent].firstChild = dependency.nextSibling;
     }
 
-    dropDependencies(previouslyOwned);
+    if (dependency.nextSibling != NoDependency)
+    {
+        m_dependencyTree[dependency.nextSibling].previousSibling = dependency.previousSibling;
+    }
 
-    m_dependencyTree.erase(previouslyOwned);
+    dropDependencies(node);
 }
 
 void matioCpp::MatvarHandler::Ownership::dropAll()
 {
+    nextGeneration();
     std::shared_ptr<PointerInfo> locked = m_main.lock();
     if (locked)
     {
         locked->deletePointer();
     }
 
-    for(std::pair<matvar_t*, Dependency> dep : m_dependencyTree)
+    for (const Dependency& dependency : m_dependencyTree)
     {
-        PointerInfo::DeletePointer(dep.first, dep.second.mode);
+        PointerInfo::DeletePointer(dependency.pointer, dependency.mode);
     }
 
+    //The memory is kept to avoid allocations when the ownership is reused
     m_dependencyTree.clear();
+    std::fill(m_lookup.begin(), m_lookup.end(), NoDependency);
+    m_firstFree = NoDependency;
+    m_numberOfDependencies = 0;
+    m_fieldIndices.clear();
+}
+
+matvar_t *matioCpp::MatvarHandler::Ownership::releaseMain()
+{
+    std::shared_ptr<PointerInfo> locked = m_main.lock();
+    if (!locked)
+    {
+        return nullptr;
+    }
+
+    matvar_t* output = locked->pointer();
+    locked->changePointer(nullptr, DeleteMode::DoNotDelete);
+    dropAll(); //The main pointer is null, hence only the dependencies are dropped
+
+    return output;
+}
+
+bool matioCpp::MatvarHandler::Ownership::getStructFieldIndex(matvar_t *structPointer, const std::string &field, size_t &index)
+{
+    std::unordered_map<const matvar_t*, std::unordered_map<std::string, size_t>>::iterator structIndex = m_fieldIndices.find(structPointer);
+
+    if (structIndex == m_fieldIndices.end())
+    {
+        size_t numberOfFields = Mat_VarGetNumberOfFields(structPointer);
+        char * const * fields = Mat_VarGetStructFieldnames(structPointer);
+
+        if (!fields || numberOfFields < minimumFieldsForIndex)
+        {
+            return findStructFieldLinearly(structPointer, field, index);
+        }
+
+        structIndex = m_fieldIndices.emplace(structPointer, std::unordered_map<std::string, size_t>()).first;
+        structIndex->second.reserve(numberOfFields);
+        for (size_t i = 0; i < numberOfFields; ++i)
+        {
+            structIndex->second.emplace(fields[i], i); //In case of duplicates, the first one is kept, as in the linear search
+        }
+    }
+
+    std::unordered_map<std::string, size_t>::const_iterator fieldIndex = structIndex->second.find(field);
+
+    if (fieldIndex == structIndex->second.end())
+    {
+        index = Mat_VarGetNumberOfFields(structPointer);
+        return false;
+    }
+
+    index = fieldIndex->second;
+    return true;
+}
+
+void matioCpp::MatvarHandler::Ownership::invalidateStructFieldIndex(const matvar_t *structPointer)
+{
+    if (!m_fieldIndices.empty())
+    {
+        m_fieldIndices.erase(structPointer);
+    }
+}
+
+void matioCpp::MatvarHandler::Ownership::nextGeneration()
+{
+    m_generation->fetch_add(1, std::memory_order_relaxed);
+}
+
+const std::shared_ptr<std::atomic<uint64_t>> &matioCpp::MatvarHandler::Ownership::generation() const
+{
+    return m_generation;
 }
 
 matioCpp::MatvarHandler::MatvarHandler()
@@ -190,24 +422,91 @@ matioCpp::MatvarHandler::MatvarHandler()
 {
 }
 
-matioCpp::MatvarHandler::MatvarHandler(matvar_t *inputPtr, DeleteMode deleteMode)
-    : m_ptr(std::make_shared<PointerInfo>(inputPtr, deleteMode))
+matioCpp::MatvarHandler::MatvarHandler(matvar_t *inputPtr, DeleteMode deleteMode, std::shared_ptr<void> dataOwner)
+    : m_ptr(std::make_shared<PointerInfo>(inputPtr, deleteMode, dataOwner))
 {
 
 }
 
 matioCpp::MatvarHandler::MatvarHandler(const matioCpp::MatvarHandler &other)
     : m_ptr(other.m_ptr)
+    , m_generation(other.m_generation)
 {
 
 }
 
 matioCpp::MatvarHandler::MatvarHandler(matioCpp::MatvarHandler &&other)
     : m_ptr(other.m_ptr)
+    , m_generation(other.m_generation)
 {
 
 }
 
+bool matioCpp::MatvarHandler::getStructFieldIndex(const std::string &field, size_t &index) const
+{
+    matvar_t* structPointer = get();
+    index = 0;
+
+    if (!structPointer)
+    {
+        return false;
+    }
+
+    std::shared_ptr<Ownership> ownership = lockOwnership();
+
+    if (!ownership)
+    {
+        return findStructFieldLinearly(structPointer, field, index);
+    }
+
+    return ownership->getStructFieldIndex(structPointer, field, index);
+}
+
+void matioCpp::MatvarHandler::invalidateStructFieldIndex() const
+{
+    std::shared_ptr<Ownership> ownership = lockOwnership();
+
+    if (ownership)
+    {
+        ownership->invalidateStructFieldIndex(get());
+    }
+}
+
+bool matioCpp::MatvarHandler::reallocateData(size_t bytes)
+{
+    matvar_t* ptr = m_ptr ? m_ptr->pointer() : nullptr;
+
+    if (!isShared() || !ptr || (m_ptr->deleteMode() != DeleteMode::Delete) || ptr->mem_conserve ||
+        ptr->isComplex || (ptr->class_type == matio_classes::MAT_C_SPARSE))
+    {
+        return false;
+    }
+
+    if (ptr->data && (ptr->nbytes == bytes))
+    {
+        return true;
+    }
+
+    void* newData = realloc(ptr->data, bytes > 0 ? bytes : 1); //The data of matio variables is allocated with malloc
+    if (!newData)
+    {
+        return false;
+    }
+
+    if (newData != ptr->data)
+    {
+        ptr->data = newData;
+        std::shared_ptr<Ownership> ownership = lockOwnership();
+        if (ownership)
+        {
+            ownership->nextGeneration(); //The cached data pointers are not valid anymore
+        }
+    }
+    ptr->nbytes = bytes;
+
+    return true;
+}
+
 matioCpp::ValueType matioCpp::MatvarHandler::valueType() const
 {
     return m_ptr->valueType();
@@ -226,6 +525,8 @@ matvar_t *matioCpp::MatvarHandler::GetMatvarDuplicate(const matvar_t *inputPtr)
         return nullptr;
     }
 
+    matioCpp::Statistics::ScopedOperation statistics(matioCpp::Statistics::Operation::DeepCopy);
+
     VariableType outputVariableType;
     ValueType outputValueType;
     matvar_t* outputPtr;
@@ -294,6 +595,15 @@ matvar_t *matioCpp::MatvarHandler::GetMatvarDuplicate(const matvar_t *inputPtr)
     else
     {
         outputPtr = Mat_VarDuplicate(inputPtr, 1); //0 Shallow copy, 1 Deep copy
+        if (outputPtr)
+        {
+            outputPtr->mem_conserve = 0; //The input may point to borrowed data (MAT_F_DONT_COPY_DATA), but the duplicate owns a copy of it that has to be freed
+        }
+    }
+
+    if (outputPtr)
+    {
+        statistics.addVariable(outputPtr);
     }
 
     return outputPtr;
@@ -304,3 +614,4 @@ void matioCpp::MatvarHandler::DeleteMatvar(matvar_t *pointerToDelete, DeleteMode
 {
     PointerInfo::DeletePointer(pointerToDelete, mode);
 }
+
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/MultiIndex.h>
+
+namespace
+{
+size_t numberOfElementsFromDimensions(matioCpp::Span<const size_t> dimensions)
+{
+    if (dimensions.size() == 0)
+    {
+        return 0;
+    }
+
+    size_t numberOfElements = 1;
+    for (size_t dim : dimensions)
+    {
+        numberOfElements *= dim;
+    }
+    return numberOfElements;
+}
+}
+
+matioCpp::MultiIndexIterator::MultiIndexIterator(matioCpp::Span<const size_t> dimensions, size_t rawIndex)
+    : m_dimensions(dimensions.begin(), dimensions.end())
+{
+    m_index.m_indices.resize(m_dimensions.size(), 0);
+
+    size_t numberOfElements = numberOfElementsFromDimensions(dimensions);
+
+    if (rawIndex >= numberOfElements)
+    {
+        m_index.m_rawIndex = numberOfElements;
+        return;
+    }
+
+    m_index.m_rawIndex = rawIndex;
+
+    size_t remainder = rawIndex;
+    for (size_t i = 0; i < m_dimensions.size(); ++i)
+    {
+        m_index.m_indices[i] = remainder % m_dimensions[i];
+        remainder /= m_dimensions[i];
+    }
+}
+
+matioCpp::MultiIndexRange::MultiIndexRange(matioCpp::Span<const size_t> dimensions)
+    : m_dimensions(dimensions.begin(), dimensions.end())
+    , m_numberOfElements(numberOfElementsFromDimensions(dimensions))
+{
+}
+
+size_t matioCpp::MultiIndexRange::size() const
+{
+    return m_numberOfElements;
+}
+
+matioCpp::MultiIndexIterator matioCpp::MultiIndexRange::begin() const
+{
+    return matioCpp::MultiIndexIterator(m_dimensions, 0);
+}
+
+matioCpp::MultiIndexIterator matioCpp::MultiIndexRange::end() const
+{
+    return matioCpp::MultiIndexIterator(m_dimensions, m_numberOfElements);
+}
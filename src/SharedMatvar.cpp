@@ -15,6 +15,7 @@ matioCpp::SharedMatvar::SharedMatvar()
     : matioCpp::MatvarHandler()
     , m_ownership(std::make_shared<MatvarHandler::Ownership>(m_ptr))
 {
+    m_generation = m_ownership->generation();
 
 }
 
@@ -32,10 +33,11 @@ matioCpp::SharedMatvar::SharedMatvar(matioCpp::SharedMatvar &&other)
 
 }
 
-matioCpp::SharedMatvar::SharedMatvar(matvar_t *inputPtr)
-    : matioCpp::MatvarHandler(inputPtr)
+matioCpp::SharedMatvar::SharedMatvar(matvar_t *inputPtr, DeleteMode deleteMode, std::shared_ptr<void> dataOwner)
+    : matioCpp::MatvarHandler(inputPtr, deleteMode, dataOwner)
     , m_ownership(std::make_shared<MatvarHandler::Ownership>(m_ptr))
 {
+    m_generation = m_ownership->generation();
 
 }
 
@@ -60,13 +62,13 @@ bool matioCpp::SharedMatvar::duplicateMatvar(const matvar_t *inputPtr)
     return importMatvar(matioCpp::MatvarHandler::GetMatvarDuplicate(inputPtr));
 }
 
-bool matioCpp::SharedMatvar::importMatvar(matvar_t *inputPtr)
+bool matioCpp::SharedMatvar::importMatvar(matvar_t *inputPtr, DeleteMode deleteMode, std::shared_ptr<void> dataOwner)
 {
     assert(m_ptr);
 
     m_ownership->dropAll();
 
-    m_ptr->changePointer(inputPtr, DeleteMode::Delete);
+    m_ptr->changePointer(inputPtr, deleteMode, dataOwner);
 
     return true;
 }
@@ -81,6 +83,7 @@ matioCpp::WeakMatvar matioCpp::SharedMatvar::weakOwnership() const
     matioCpp::WeakMatvar weak;
     weak.m_ownership = m_ownership;
     weak.m_ptr = m_ptr;
+    weak.m_generation = m_generation;
     return weak;
 }
 
@@ -89,10 +92,24 @@ void matioCpp::SharedMatvar::dropOwnedPointer(matvar_t *previouslyOwnedPointer)
     m_ownership->drop(previouslyOwnedPointer);
 }
 
+matvar_t *matioCpp::SharedMatvar::releaseMatvar()
+{
+    assert(m_ptr);
+
+    //The other SharedMatvar sharing the same pointer also share the same ownership object
+    if ((m_ownership.use_count() != 1) || !m_ptr->pointer() || (m_ptr->deleteMode() != DeleteMode::Delete))
+    {
+        return nullptr;
+    }
+
+    return m_ownership->releaseMain();
+}
+
 matioCpp::SharedMatvar &matioCpp::SharedMatvar::operator=(const matioCpp::SharedMatvar &other)
 {
     m_ownership = other.m_ownership;
     m_ptr = other.m_ptr;
+    m_generation = other.m_generation;
     return *this;
 }
 
@@ -100,9 +117,15 @@ matioCpp::SharedMatvar &matioCpp::SharedMatvar::operator=(matioCpp::SharedMatvar
 {
     m_ownership = other.m_ownership;
     m_ptr = other.m_ptr;
+    m_generation = other.m_generation;
     return *this;
 }
 
+std::shared_ptr<matioCpp::MatvarHandler::Ownership> matioCpp::SharedMatvar::lockOwnership() const
+{
+    return m_ownership;
+}
+
 std::weak_ptr<matioCpp::MatvarHandler::Ownership> matioCpp::SharedMatvar::ownership() const
 {
     return m_ownership;
@@ -113,5 +136,6 @@ matioCpp::SharedMatvar matioCpp::SharedMatvar::GetMatvarShallowDuplicate(const m
     SharedMatvar output;
     output.m_ptr = std::make_shared<PointerInfo>(Mat_VarDuplicate(inputPtr, 0), DeleteMode::ShallowDelete);
     output.m_ownership = std::make_shared<MatvarHandler::Ownership>(output.m_ptr);
+    output.m_generation = output.m_ownership->generation();
     return output;
 }
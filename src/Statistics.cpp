@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/Statistics.h>
+#include <matioCpp/Tracing.h>
+#include <atomic>
+
+namespace
+{
+    struct AtomicCounters
+    {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> nodes{0};
+        std::atomic<uint64_t> nanoseconds{0};
+    };
+
+    AtomicCounters globalCounters[matioCpp::Statistics::NumberOfOperations];
+
+    const char* operationLabel(matioCpp::Statistics::Operation operation)
+    {
+        switch (operation)
+        {
+        case matioCpp::Statistics::Operation::FileRead:
+            return "FileRead";
+        case matioCpp::Statistics::Operation::FileWrite:
+            return "FileWrite";
+        case matioCpp::Statistics::Operation::FileWriteCompressed:
+            return "FileWriteCompressed";
+        case matioCpp::Statistics::Operation::VariableInitialization:
+            return "VariableInitialization";
+        case matioCpp::Statistics::Operation::DeepCopy:
+            return "DeepCopy";
+        }
+        return "Unknown";
+    }
+
+#if defined(MATIOCPP_ENABLE_STATISTICS) || defined(MATIOCPP_ENABLE_TRACING)
+    thread_local size_t activeOperations[matioCpp::Statistics::NumberOfOperations] = {};
+
+    void countVariable(const matvar_t* variable, uint64_t& bytes, uint64_t& nodes)
+    {
+        if (!variable)
+        {
+            return;
+        }
+
+        nodes++;
+
+        if ((variable->class_type != matio_classes::MAT_C_CELL) && (variable->class_type != matio_classes::MAT_C_STRUCT))
+        {
+            bytes += variable->nbytes;
+            return;
+        }
+
+        if (!variable->data)
+        {
+            return;
+        }
+
+        size_t elements = variable->nbytes / sizeof(matvar_t*);
+        matvar_t** children = static_cast<matvar_t**>(variable->data);
+        for (size_t i = 0; i < elements; ++i)
+        {
+            countVariable(children[i], bytes, nodes);
+        }
+    }
+#endif
+}
+
+constexpr size_t matioCpp::Statistics::NumberOfOperations;
+
+const matioCpp::Statistics::Counters &matioCpp::Statistics::Snapshot::operator[](Operation operation) const
+{
+    return m_counters[static_cast<size_t>(operation)];
+}
+
+#if defined(MATIOCPP_ENABLE_STATISTICS) || defined(MATIOCPP_ENABLE_TRACING)
+matioCpp::Statistics::ScopedOperation::ScopedOperation(Operation operation)
+    : m_operation(operation)
+    , m_outermost(activeOperations[static_cast<size_t>(operation)]++ == 0)
+    , m_start(std::chrono::steady_clock::now())
+{
+}
+
+matioCpp::Statistics::ScopedOperation::~ScopedOperation()
+{
+    size_t index = static_cast<size_t>(m_operation);
+    activeOperations[index]--;
+
+    if (!m_outermost)
+    {
+        return;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+#ifdef MATIOCPP_ENABLE_TRACING
+    matioCpp::Tracing::record(operationLabel(m_operation), m_start, end, m_variableName, m_bytes);
+#endif
+
+#ifdef MATIOCPP_ENABLE_STATISTICS
+    if (m_completed)
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start);
+        AtomicCounters& counters = globalCounters[index];
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(m_bytes, std::memory_order_relaxed);
+        counters.nodes.fetch_add(m_nodes, std::memory_order_relaxed);
+        counters.nanoseconds.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+    }
+#endif
+}
+
+void matioCpp::Statistics::ScopedOperation::addVariable(const matvar_t *variable)
+{
+    m_completed = true;
+    if (m_outermost && variable)
+    {
+        countVariable(variable, m_bytes, m_nodes);
+        m_variableName = variable->name;
+    }
+}
+
+void matioCpp::Statistics::ScopedOperation::addData(size_t bytes, size_t nodes)
+{
+    m_completed = true;
+    m_bytes += bytes;
+    m_nodes += nodes;
+}
+#endif
+
+matioCpp::Statistics::Snapshot matioCpp::Statistics::snapshot()
+{
+    Snapshot output;
+    for (size_t i = 0; i < NumberOfOperations; ++i)
+    {
+        output.m_counters[i].count = globalCounters[i].count.load(std::memory_order_relaxed);
+        output.m_counters[i].bytes = globalCounters[i].bytes.load(std::memory_order_relaxed);
+        output.m_counters[i].nodes = globalCounters[i].nodes.load(std::memory_order_relaxed);
+        output.m_counters[i].nanoseconds = globalCounters[i].nanoseconds.load(std::memory_order_relaxed);
+    }
+    return output;
+}
+
+void matioCpp::Statistics::reset()
+{
+    for (AtomicCounters& counters : globalCounters)
+    {
+        counters.count = 0;
+        counters.bytes = 0;
+        counters.nodes = 0;
+        counters.nanoseconds = 0;
+    }
+}
+
+std::string matioCpp::Statistics::operationName(Operation operation)
+{
+    return operationLabel(operation);
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/StridedView.h>
+
+constexpr size_t matioCpp::Slice::End;
+
+matioCpp::Slice::Slice(size_t index)
+    : m_start(index)
+    , m_stop(index + 1)
+    , m_step(1)
+{
+}
+
+matioCpp::Slice::Slice(size_t start, size_t stop, size_t step)
+    : m_start(start)
+    , m_stop(stop)
+    , m_step(step)
+{
+}
+
+matioCpp::Slice matioCpp::Slice::All()
+{
+    return matioCpp::Slice();
+}
+
+size_t matioCpp::Slice::start() const
+{
+    return m_start;
+}
+
+size_t matioCpp::Slice::stop() const
+{
+    return m_stop;
+}
+
+size_t matioCpp::Slice::step() const
+{
+    return m_step;
+}
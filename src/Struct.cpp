@@ -7,6 +7,7 @@
 
 
 #include <matioCpp/Struct.h>
+#include <matioCpp/Tracing.h>
 
 bool matioCpp::Struct::checkCompatibility(const matvar_t* inputPtr, matioCpp::VariableType variableType, matioCpp::ValueType) const
 {
@@ -67,6 +68,31 @@ matioCpp::Struct::Struct(const std::string &name, const std::vector<Variable> &e
                        vectorOfPointers.data());
 }
 
+matioCpp::Struct::Struct(const std::string &name, std::vector<Variable> &&elements)
+{
+    size_t emptyDimensions[] = {1, 1};
+    std::vector<matvar_t*> vectorOfPointers;
+    vectorOfPointers.reserve(elements.size() + 1);
+    for (size_t i = 0; i < elements.size(); ++i)
+    {
+        if (elements[i].isValid())
+        {
+            matvar_t* released = releaseMatvar(elements[i]);
+            vectorOfPointers.push_back(released ? released : matioCpp::MatvarHandler::GetMatvarDuplicate(elements[i].toMatio()));
+        }
+        else
+        {
+            std::cerr << "[ERROR][matioCpp::Struct::Struct] The element of " << name << " at index " << i << " (0-based) is not valid. It will be skipped." << std::endl;
+        }
+    }
+    vectorOfPointers.push_back(nullptr);  //The vector of pointers has to be null terminated
+
+    initializeVariable(name,
+                       VariableType::Struct,
+                       matioCpp::ValueType::VARIABLE, emptyDimensions,
+                       vectorOfPointers.data());
+}
+
 matioCpp::Struct::Struct(const matioCpp::Struct &other)
 {
     fromOther(other);
@@ -189,6 +215,28 @@ bool matioCpp::Struct::setField(const matioCpp::Variable &newValue)
     return setStructField(newValue.name(), newValue);
 }
 
+bool matioCpp::Struct::setField(matioCpp::Struct::index_type index, matioCpp::Variable &&newValue)
+{
+    assert(index < numberOfFields() && "The specified index is out of bounds");
+    return setStructField(index, std::move(newValue));
+}
+
+bool matioCpp::Struct::setField(const std::string &field, matioCpp::Variable &&newValue)
+{
+    return setStructField(field, std::move(newValue));
+}
+
+bool matioCpp::Struct::setField(matioCpp::Variable &&newValue)
+{
+    std::string field = newValue.name();
+    return setStructField(field, std::move(newValue));
+}
+
+bool matioCpp::Struct::setFields(std::vector<matioCpp::Variable> &&newValues)
+{
+    return setStructFields(std::move(newValues));
+}
+
 matioCpp::Variable matioCpp::Struct::operator()(matioCpp::Struct::index_type el)
 {
     assert(el < numberOfFields() && "The specified index is out of bounds");
@@ -203,6 +251,8 @@ const matioCpp::Variable matioCpp::Struct::operator()(matioCpp::Struct::index_ty
 
 matioCpp::Variable matioCpp::Struct::operator()(const std::string &el)
 {
+    matioCpp::Tracing::ScopedEvent event("Struct field access");
+    event.setDetails(el.c_str());
     size_t index = getFieldIndex(el);
     assert(index < numberOfFields() && "The specified field does not exist.");
     return getStructField(index);
@@ -210,6 +260,8 @@ matioCpp::Variable matioCpp::Struct::operator()(const std::string &el)
 
 const matioCpp::Variable matioCpp::Struct::operator()(const std::string &el) const
 {
+    matioCpp::Tracing::ScopedEvent event("Struct field access");
+    event.setDetails(el.c_str());
     size_t index = getFieldIndex(el);
     assert(index < numberOfFields() && "The specified field does not exist.");
     return getStructField(index);
@@ -7,6 +7,7 @@
 
 
 #include <matioCpp/StructArray.h>
+#include <matioCpp/FieldHandle.h>
 
 bool matioCpp::StructArray::checkCompatibility(const matvar_t* inputPtr, matioCpp::VariableType variableType, matioCpp::ValueType) const
 {
@@ -26,6 +27,146 @@ bool matioCpp::StructArray::checkCompatibility(const matvar_t* inputPtr, matioCp
     return true;
 }
 
+bool matioCpp::StructArray::checkVectorOfStructs(const std::vector<size_t> &dimensions, const std::vector<matioCpp::Struct> &elements, const std::string &caller) const
+{
+    size_t totalElements = 1;
+    for (size_t dim : dimensions)
+    {
+        totalElements *= dim;
+    }
+
+    if (totalElements != elements.size())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The size of elements vector does not match the provided dimensions. The total number is different." << std::endl;
+        return false;
+    }
+
+    if (elements.size() == 0)
+    {
+        return true;
+    }
+
+    if (!elements[0].isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The element at index 0 (0-based) is not valid." << std::endl;
+        return false;
+    }
+
+    size_t firstNumberOfFields = elements[0].numberOfFields();
+    char * const * firstFields = elements[0].getStructFields();
+
+    for (size_t i = 1; i < elements.size(); ++i)
+    {
+        if (!elements[i].isValid())
+        {
+            std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The element at index "<< i << " (0-based) is not valid." << std::endl;
+            return false;
+        }
+
+        if (elements[i].numberOfFields() != firstNumberOfFields)
+        {
+            std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The element at index "<< i << " (0-based) has a number of fields different from the others. All Structs are supposed to have the same set of fields." << std::endl;
+            return false;
+        }
+
+        char * const * otherFields = elements[i].getStructFields();
+        if (otherFields == firstFields)
+        {
+            continue; //The elements share the same table of field names
+        }
+
+        for (size_t field = 0; field < firstNumberOfFields; ++field)
+        {
+            if (strcmp(firstFields[field], otherFields[field]) != 0)
+            {
+                std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The element at index "<< i << " (0-based) has a set of fields different from the others. All Structs are supposed to have the same set of fields." << std::endl;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool matioCpp::StructArray::checkElementFields(const matioCpp::Struct &newValue, const std::string &caller) const
+{
+    if (!newValue.isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The input struct is not valid." << std::endl;
+        return false;
+    }
+
+    if (numberOfFields() != newValue.numberOfFields())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The input struct is supposed to have the same number of fields of the struct array." <<std::endl;
+        return false;
+    }
+
+    char * const * arrayFields = getStructFields();
+    char * const * structFields = newValue.getStructFields();
+
+    for (size_t i = 0; i < numberOfFields(); ++i)
+    {
+        if (strcmp(arrayFields[i], structFields[i]) != 0)
+        {
+            std::cerr << "[ERROR][matioCpp::StructArray::" << caller << "] The field " << structFields[i] << " of the input struct is supposed to be " << arrayFields[i]
+                      << ". Cannot insert in a struct array a new field in a single element." <<std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool matioCpp::StructArray::prepareNewElements(matioCpp::Span<const matioCpp::Struct> newValues, const std::string &caller)
+{
+    if (newValues.size() == 0)
+    {
+        return true;
+    }
+
+    if ((numberOfElements() == 0) && (numberOfFields() == 0) && newValues[0].isValid())
+    {
+        //An empty array takes the fields of the first element
+        if (!addFields(newValues[0].fields()))
+        {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(newValues.size()); ++i)
+    {
+        if (!checkElementFields(newValues[i], caller))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool matioCpp::StructArray::moveInEmptyElement(size_t el, matioCpp::Struct &&newValue)
+{
+    matvar_t* released = releaseMatvar(newValue);
+    if (!released)
+    {
+        return setElement(el, newValue);
+    }
+
+    //Take the fields and free only the container
+    matvar_t** fields = static_cast<matvar_t**>(released->data);
+    for (size_t field = 0; field < numberOfFields(); ++field)
+    {
+        matvar_t* previousField = Mat_VarSetStructFieldByIndex(toMatio(), field, el, fields[field]);
+        assert(!previousField && "[matioCpp::StructArray::moveInEmptyElement] The element is not empty.");
+        matioCpp::unused(previousField);
+        fields[field] = nullptr;
+    }
+    Mat_VarFree(released);
+
+    return true;
+}
+
 matioCpp::StructArray::StructArray()
 {
     size_t emptyDimensions[] = {0, 0};
@@ -63,76 +204,78 @@ matioCpp::StructArray::StructArray(const std::string &name, const std::vector<ma
 
 matioCpp::StructArray::StructArray(const std::string &name, const std::vector<matioCpp::StructArray::index_type> &dimensions, const std::vector<matioCpp::Struct> &elements)
 {
-    bool abort = false;
-    matioCpp::StructArray::index_type totalElements = 1;
-    for (matioCpp::StructArray::index_type dim : dimensions)
+    bool validElements = checkVectorOfStructs(dimensions, elements, "StructArray");
+    assert(validElements);
+
+    if (validElements && elements.size() > 0)
     {
-        totalElements *= dim;
-    }
+        size_t numberOfFields = elements[0].numberOfFields();
+        std::vector<matvar_t*> vectorOfPointers(elements.size() * numberOfFields + 1, nullptr);
 
-    if (totalElements != elements.size())
+        size_t innerIndex = 0;
+        for (size_t i = 0; i < elements.size(); ++i)
+        {
+            for (size_t field = 0; field < numberOfFields; ++field)
+            {
+                vectorOfPointers[innerIndex] = matioCpp::MatvarHandler::GetMatvarDuplicate(elements[i][field].toMatio());
+                innerIndex++;
+            }
+        }
+
+        initializeVariable(name,
+                           VariableType::StructArray,
+                           matioCpp::ValueType::VARIABLE, dimensions,
+                           vectorOfPointers.data());
+    }
+    else
     {
-        std::cerr << "[ERROR][matioCpp::StructArray::StructArray] The size of elements vector does not match the provided dimensions. The total number is different." << std::endl;
-        assert(false);
-        abort = true;
+        initializeVariable(name,
+                           VariableType::StructArray,
+                           matioCpp::ValueType::VARIABLE, dimensions,
+                           nullptr);
     }
+}
 
+matioCpp::StructArray::StructArray(const std::string &name, const std::vector<matioCpp::StructArray::index_type> &dimensions, std::vector<matioCpp::Struct> &&elements)
+{
+    bool validElements = checkVectorOfStructs(dimensions, elements, "StructArray");
+    assert(validElements);
 
-    if (!abort && elements.size() > 0)
+    if (validElements && elements.size() > 0)
     {
-        size_t firstNumberOfFields = elements[0].numberOfFields();
-        char * const * firstFields = elements[0].getStructFields();
-
-        std::vector<matvar_t*> vectorOfPointers(totalElements * firstNumberOfFields + 1, nullptr);
+        size_t numberOfFields = elements[0].numberOfFields();
+        std::vector<matvar_t*> vectorOfPointers(elements.size() * numberOfFields + 1, nullptr);
 
         size_t innerIndex = 0;
-
-        for (size_t i = 0; (i < totalElements) && !abort; ++i)
+        for (size_t i = 0; i < elements.size(); ++i)
         {
-            if (!elements[i].isValid())
-            {
-                std::cerr << "[ERROR][matioCpp::StructArray::StructArray] The element at index "<< i << " (0-based) is not valid." << std::endl;
-                abort = true;
-                assert(false);
-            }
-
-            if (elements[i].numberOfFields() != firstNumberOfFields)
+            matvar_t* released = releaseMatvar(elements[i]);
+            if (released)
             {
-                std::cerr << "[ERROR][matioCpp::StructArray::StructArray] The element at index "<< i << " (0-based) has a number of fields different from the others. All Structs are supposed to have the same set of fields." << std::endl;
-                abort = true;
-                assert(false);
+                //Take the fields and free only the container
+                matvar_t** fields = static_cast<matvar_t**>(released->data);
+                for (size_t field = 0; field < numberOfFields; ++field)
+                {
+                    vectorOfPointers[innerIndex] = fields[field];
+                    fields[field] = nullptr;
+                    innerIndex++;
+                }
+                Mat_VarFree(released);
             }
-            char * const * otherFields = elements[i].getStructFields();
-
-            for (size_t field = 0; (field < firstNumberOfFields) && !abort; ++field)
+            else
             {
-                if (strcmp(firstFields[field], otherFields[field]) != 0)
+                for (size_t field = 0; field < numberOfFields; ++field)
                 {
-                    std::cerr << "[ERROR][matioCpp::StructArray::StructArray] The element at index "<< i << " (0-based) has a set of fields different from the others. All Structs are supposed to have the same set of fields." << std::endl;
-                    abort = true;
-                    assert(false);
+                    vectorOfPointers[innerIndex] = matioCpp::MatvarHandler::GetMatvarDuplicate(elements[i][field].toMatio());
+                    innerIndex++;
                 }
-                vectorOfPointers[innerIndex] = matioCpp::MatvarHandler::GetMatvarDuplicate(elements[i][field].toMatio());
-                innerIndex++;
             }
         }
-        assert(innerIndex == totalElements * firstNumberOfFields);
-
-        if (!abort)
-        {
-            initializeVariable(name,
-                               VariableType::StructArray,
-                               matioCpp::ValueType::VARIABLE, dimensions,
-                               vectorOfPointers.data());
-        }
-        else
-        {
-            initializeVariable(name,
-                               VariableType::StructArray,
-                               matioCpp::ValueType::VARIABLE, dimensions,
-                               nullptr);
-        }
 
+        initializeVariable(name,
+                           VariableType::StructArray,
+                           matioCpp::ValueType::VARIABLE, dimensions,
+                           vectorOfPointers.data());
     }
     else
     {
@@ -141,7 +284,6 @@ matioCpp::StructArray::StructArray(const std::string &name, const std::vector<ma
                            matioCpp::ValueType::VARIABLE, dimensions,
                            nullptr);
     }
-
 }
 
 matioCpp::StructArray::StructArray(const std::string &name, const std::vector<matioCpp::StructArray::index_type> &dimensions, const std::vector<std::string> &fields)
@@ -209,56 +351,25 @@ matioCpp::StructArray &matioCpp::StructArray::operator=(matioCpp::StructArray &&
 
 bool matioCpp::StructArray::fromVectorOfStructs(const std::vector<matioCpp::StructArray::index_type> &dimensions, const std::vector<matioCpp::Struct> &elements)
 {
-    matioCpp::StructArray::index_type totalElements = 1;
-    for (matioCpp::StructArray::index_type dim : dimensions)
+    if (!checkVectorOfStructs(dimensions, elements, "fromVectorOfStructs"))
     {
-        totalElements *= dim;
-    }
-
-    if (totalElements != elements.size())
-    {
-        std::cerr << "[ERROR][matioCpp::StructArray::fromVectorOfStructs] The size of elements vector does not match the provided dimensions. The total number is different." << std::endl;
         return false;
     }
 
-
     if (elements.size() > 0)
     {
-        size_t firstNumberOfFields = elements[0].numberOfFields();
-        char * const * firstFields = elements[0].getStructFields();
-
-        std::vector<matvar_t*> vectorOfPointers(totalElements * firstNumberOfFields + 1, nullptr);
+        size_t numberOfFields = elements[0].numberOfFields();
+        std::vector<matvar_t*> vectorOfPointers(elements.size() * numberOfFields + 1, nullptr);
 
         size_t innerIndex = 0;
-
-        for (size_t i = 0; i < totalElements; ++i)
+        for (size_t i = 0; i < elements.size(); ++i)
         {
-            if (!elements[i].isValid())
-            {
-                std::cerr << "[ERROR][matioCpp::StructArray::fromVectorOfStructs] The element at index "<< i << " (0-based) is not valid." << std::endl;
-                return false;
-            }
-
-            if (elements[i].numberOfFields() != firstNumberOfFields)
-            {
-                std::cerr << "[ERROR][matioCpp::StructArray::fromVectorOfStructs] The element at index "<< i << " (0-based) has a number of fields different from the others. All Structs are supposed to have the same set of fields." << std::endl;
-                return false;
-            }
-            char * const * otherFields = elements[i].getStructFields();
-
-            for (size_t field = 0; field < firstNumberOfFields; ++field)
+            for (size_t field = 0; field < numberOfFields; ++field)
             {
-                if (strcmp(firstFields[field], otherFields[field]) != 0)
-                {
-                    std::cerr << "[ERROR][matioCpp::StructArray::fromVectorOfStructs] The element at index "<< i << " (0-based) has a set of fields different from the others. All Structs are supposed to have the same set of fields." << std::endl;
-                    return false;
-                }
                 vectorOfPointers[innerIndex] = matioCpp::MatvarHandler::GetMatvarDuplicate(elements[i][field].toMatio());
                 innerIndex++;
             }
         }
-        assert(innerIndex == totalElements * firstNumberOfFields);
-
 
         return initializeVariable(name(),
                                   VariableType::StructArray,
@@ -277,18 +388,19 @@ bool matioCpp::StructArray::fromVectorOfStructs(const std::vector<matioCpp::Stru
 
 matioCpp::StructArray::index_type matioCpp::StructArray::rawIndexFromIndices(const std::vector<matioCpp::StructArray::index_type> &el) const
 {
-    assert(dimensions().size() > 0 && numberOfElements() > 0 && "[matioCpp::StructArray::rawIndexFromIndices] The array is empty.");
-    assert(el.size() > 0 == dimensions().size() > 0 && "[matioCpp::StructArray::rawIndexFromIndices] The input vector el should have the same number of dimensions of the array.");
-    assert(el[0] < dimensions()[0] && "[matioCpp::StructArray::rawIndexFromIndices] The required element is out of bounds.");
+    matioCpp::Span<const size_t> dims = dimensions();
+    assert(dims.size() > 0 && numberOfElements() > 0 && "[matioCpp::StructArray::rawIndexFromIndices] The array is empty.");
+    assert(el.size() > 0 == dims.size() > 0 && "[matioCpp::StructArray::rawIndexFromIndices] The input vector el should have the same number of dimensions of the array.");
+    assert(el[0] < dims[0] && "[matioCpp::StructArray::rawIndexFromIndices] The required element is out of bounds.");
 
     typename matioCpp::StructArray::index_type index = 0;
     typename matioCpp::StructArray::index_type previousDimensionsFactorial = 1;
 
     for (size_t i = 0; i < el.size(); ++i)
     {
-        assert(el[i] < dimensions()[i] && "[matioCpp::StructArray::rawIndexFromIndices] The required element is out of bounds.");
+        assert(el[i] < dims[i] && "[matioCpp::StructArray::rawIndexFromIndices] The required element is out of bounds.");
         index += el[i] * previousDimensionsFactorial;
-        previousDimensionsFactorial *= dimensions()[i];
+        previousDimensionsFactorial *= dims[i];
     }
 
     return index;
@@ -296,7 +408,8 @@ matioCpp::StructArray::index_type matioCpp::StructArray::rawIndexFromIndices(con
 
 bool matioCpp::StructArray::indicesFromRawIndex(size_t rawIndex, std::vector<matioCpp::StructArray::index_type> &el) const
 {
-    el.resize(dimensions().size());
+    matioCpp::Span<const size_t> dims = dimensions();
+    el.resize(dims.size());
 
     if (rawIndex >= numberOfElements())
     {
@@ -304,14 +417,14 @@ bool matioCpp::StructArray::indicesFromRawIndex(size_t rawIndex, std::vector<mat
         return false;
     }
 
-    size_t previousDimensionsFactorial = dimensions()[0];
+    size_t previousDimensionsFactorial = dims[0];
 
     //First we fill el with the factorial of the dimensions
 
     for (size_t i = 1; i < el.size(); ++i)
     {
         el[i - 1] = previousDimensionsFactorial;
-        previousDimensionsFactorial *= dimensions()[i];
+        previousDimensionsFactorial *= dims[i];
     }
 
     size_t remainder = rawIndex;
@@ -326,6 +439,11 @@ bool matioCpp::StructArray::indicesFromRawIndex(size_t rawIndex, std::vector<mat
     return true;
 }
 
+matioCpp::MultiIndexRange matioCpp::StructArray::indices() const
+{
+    return matioCpp::MultiIndexRange(dimensions());
+}
+
 bool matioCpp::StructArray::setName(const std::string &newName)
 {
     return changeName(newName);
@@ -333,8 +451,153 @@ bool matioCpp::StructArray::setName(const std::string &newName)
 
 void matioCpp::StructArray::resize(const std::vector<matioCpp::StructArray::index_type> &newDimensions)
 {
-    matioCpp::StructArray newArray(name(), newDimensions);
-    fromOther(std::move(newArray));
+    for (matioCpp::StructArray::index_type dim : newDimensions)
+    {
+        if (dim == 0)
+        {
+            std::cerr << "[ERROR][matioCpp::StructArray::resize] Zero dimension detected." << std::endl;
+            assert(false);
+            return;
+        }
+    }
+
+    bool ok = resizeArray(newDimensions);
+    matioCpp::unused(ok);
+    assert(ok && "Failed to resize.");
+}
+
+bool matioCpp::StructArray::push_back(const matioCpp::Struct &newValue)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::push_back] The StructArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!prepareNewElements(matioCpp::Span<const matioCpp::Struct>(&newValue, 1), "push_back"))
+    {
+        return false;
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::StructArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(1))
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::push_back] Failed to add an element to the array." << std::endl;
+        return false;
+    }
+
+    if (!setElement(position, newValue))
+    {
+        resizeArray(previousDimensions);
+        return false;
+    }
+
+    return true;
+}
+
+bool matioCpp::StructArray::push_back(matioCpp::Struct &&newValue)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::push_back] The StructArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!prepareNewElements(matioCpp::Span<const matioCpp::Struct>(&newValue, 1), "push_back"))
+    {
+        return false;
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::StructArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(1))
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::push_back] Failed to add an element to the array." << std::endl;
+        return false;
+    }
+
+    if (!moveInEmptyElement(position, std::move(newValue)))
+    {
+        resizeArray(previousDimensions);
+        return false;
+    }
+
+    return true;
+}
+
+bool matioCpp::StructArray::append(const std::vector<matioCpp::Struct> &newValues)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::append] The StructArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!prepareNewElements(matioCpp::make_span(newValues), "append"))
+    {
+        return false;
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::StructArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(newValues.size()))
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::append] Failed to add the elements to the array." << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        if (!setElement(position + i, newValues[i]))
+        {
+            resizeArray(previousDimensions);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool matioCpp::StructArray::append(std::vector<matioCpp::Struct> &&newValues)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::append] The StructArray has not been properly initialized." << std::endl;
+        return false;
+    }
+
+    if (!prepareNewElements(matioCpp::make_span(newValues), "append"))
+    {
+        return false;
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> previousDimensions(currentDimensions.begin(), currentDimensions.end());
+    matioCpp::StructArray::index_type position = numberOfElements();
+
+    if (!appendArrayElements(newValues.size()))
+    {
+        std::cerr << "[ERROR][matioCpp::StructArray::append] Failed to add the elements to the array." << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        if (!moveInEmptyElement(position + i, std::move(newValues[i])))
+        {
+            resizeArray(previousDimensions);
+            return false;
+        }
+    }
+
+    return true;
 }
 
 matioCpp::StructArray::index_type matioCpp::StructArray::numberOfElements() const
@@ -382,6 +645,11 @@ size_t matioCpp::StructArray::getFieldIndex(const std::string &field) const
     return index;
 }
 
+matioCpp::FieldHandle matioCpp::StructArray::getFieldHandle(const std::string &field) const
+{
+    return matioCpp::FieldHandle(*this, field);
+}
+
 bool matioCpp::StructArray::addField(const std::string &newField)
 {
     if (!addStructField(newField))
@@ -412,24 +680,15 @@ bool matioCpp::StructArray::setElement(matioCpp::StructArray::index_type el, con
 {
     assert(el < numberOfElements() && "The requested element is out of bounds.");
 
-    char * const * arrayFields = getStructFields();
-    char * const * structFields = newValue.getStructFields();
-
-    if (numberOfFields() != newValue.numberOfFields())
+    if (!checkElementFields(newValue, "setElement"))
     {
-        std::cerr << "[ERROR][matioCpp::StructArray::setElement] The input struct is supposed to have the same number of fields of the struct array." <<std::endl;
         return false;
     }
 
+    char * const * structFields = newValue.getStructFields();
+
     for (size_t i = 0; i < numberOfFields(); ++i)
     {
-        if (strcmp(arrayFields[i], structFields[i]) != 0)
-        {
-            std::cerr << "[ERROR][matioCpp::StructArray::setElement] The field " << structFields[i] << " of the input struct is supposed to be " << arrayFields[i]
-                      << ". Cannot insert in a struct array a new field in a single element." <<std::endl;
-            return false;
-        }
-
         bool ok = setStructField(i, newValue(i), el);
         if (!ok)
         {
@@ -489,4 +748,26 @@ matioCpp::StructArray::ConstElement matioCpp::StructArray::operator [](matioCpp:
     return matioCpp::StructArray::ConstElement(el, this);
 }
 
+matioCpp::StructArray::Element matioCpp::StructArray::operator ()(const matioCpp::MultiIndex &el)
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::StructArray::operator()] The required element is out of bounds.");
+    return matioCpp::StructArray::Element(el.rawIndex(), this);
+}
 
+matioCpp::StructArray::ConstElement matioCpp::StructArray::operator ()(const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::StructArray::operator()] The required element is out of bounds.");
+    return matioCpp::StructArray::ConstElement(el.rawIndex(), this);
+}
+
+matioCpp::StructArray::Element matioCpp::StructArray::operator [](const matioCpp::MultiIndex &el)
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::StructArray::operator[]] The required element is out of bounds.");
+    return matioCpp::StructArray::Element(el.rawIndex(), this);
+}
+
+matioCpp::StructArray::ConstElement matioCpp::StructArray::operator [](const matioCpp::MultiIndex &el) const
+{
+    assert(el.rawIndex() < numberOfElements() && "[matioCpp::StructArray::operator[]] The required element is out of bounds.");
+    return matioCpp::StructArray::ConstElement(el.rawIndex(), this);
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <matioCpp/Tracing.h>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef MATIOCPP_ENABLE_TRACING
+namespace
+{
+    struct Event
+    {
+        const char* name;
+        uint64_t begin; // Nanoseconds since the start of the recording
+        uint64_t duration;
+        uint64_t bytes;
+        char detail[64];
+    };
+
+    // Written only by the owning thread. The events before size are complete and can be read by any thread.
+    struct ThreadBuffer
+    {
+        uint64_t session{0};
+        size_t threadIndex{0};
+        std::vector<Event> events;
+        std::atomic<size_t> size{0};
+    };
+
+    struct TraceState
+    {
+        std::mutex mutex; // Protects the list of buffers, not their content
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        std::atomic<bool> recording{false};
+        std::atomic<uint64_t> session{0};
+        std::atomic<size_t> dropped{0};
+        size_t eventsPerThread{0};
+        std::atomic<int64_t> epoch{0}; // Nanoseconds of the steady clock at the start of the recording
+    };
+
+    TraceState& state()
+    {
+        static TraceState* instance = new TraceState(); // Never deleted, events may be recorded during the static destruction
+        return *instance;
+    }
+
+    thread_local std::shared_ptr<ThreadBuffer> localBuffer;
+
+    ThreadBuffer* getLocalBuffer(uint64_t session)
+    {
+        if (localBuffer && localBuffer->session == session)
+        {
+            return localBuffer.get();
+        }
+
+        TraceState& trace = state();
+        std::lock_guard<std::mutex> lock(trace.mutex);
+        if (trace.session.load() != session)
+        {
+            return nullptr; // Restarted in the meanwhile
+        }
+        localBuffer = std::make_shared<ThreadBuffer>();
+        localBuffer->session = session;
+        localBuffer->threadIndex = trace.buffers.size() + 1;
+        localBuffer->events.resize(trace.eventsPerThread);
+        trace.buffers.push_back(localBuffer);
+        return localBuffer.get();
+    }
+
+    void writeEscaped(std::ostream& output, const char* text)
+    {
+        for (const char* c = text; *c != '\0'; ++c)
+        {
+            unsigned char character = static_cast<unsigned char>(*c);
+            if (character == '"' || character == '\\')
+            {
+                output << '\\' << *c;
+            }
+            else if (character >= 0x20)
+            {
+                output << *c;
+            }
+        }
+    }
+}
+
+matioCpp::Tracing::ScopedEvent::ScopedEvent(const char *name)
+    : m_name(name)
+    , m_active(state().recording.load(std::memory_order_relaxed))
+{
+    if (m_active)
+    {
+        m_begin = std::chrono::steady_clock::now();
+    }
+}
+
+matioCpp::Tracing::ScopedEvent::~ScopedEvent()
+{
+    if (m_active)
+    {
+        record(m_name, m_begin, std::chrono::steady_clock::now(), m_detail, m_bytes);
+    }
+}
+
+void matioCpp::Tracing::ScopedEvent::setDetails(const char *detail, size_t bytes)
+{
+    m_detail = detail;
+    m_bytes = bytes;
+}
+#endif
+
+bool matioCpp::Tracing::start(size_t eventsPerThread)
+{
+#ifdef MATIOCPP_ENABLE_TRACING
+    TraceState& trace = state();
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    trace.recording = false;
+    trace.buffers.clear(); // The threads still writing keep their buffer alive
+    trace.eventsPerThread = eventsPerThread;
+    trace.dropped = 0;
+    trace.epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    trace.session++;
+    trace.recording = true;
+    return true;
+#else
+    (void)eventsPerThread;
+    std::cerr << "[ERROR][matioCpp::Tracing::start] The library has been compiled without the MATIOCPP_ENABLE_TRACING option." << std::endl;
+    return false;
+#endif
+}
+
+void matioCpp::Tracing::stop()
+{
+#ifdef MATIOCPP_ENABLE_TRACING
+    state().recording = false;
+#endif
+}
+
+bool matioCpp::Tracing::isRecording()
+{
+#ifdef MATIOCPP_ENABLE_TRACING
+    return state().recording.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+size_t matioCpp::Tracing::droppedEvents()
+{
+#ifdef MATIOCPP_ENABLE_TRACING
+    return state().dropped.load();
+#else
+    return 0;
+#endif
+}
+
+void matioCpp::Tracing::record(const char *name, const time_point &begin, const time_point &end, const char *detail, size_t bytes)
+{
+#ifdef MATIOCPP_ENABLE_TRACING
+    TraceState& trace = state();
+    if (!trace.recording.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    ThreadBuffer* buffer = getLocalBuffer(trace.session.load());
+    if (!buffer)
+    {
+        return;
+    }
+
+    size_t index = buffer->size.load(std::memory_order_relaxed);
+    if (index >= buffer->events.size())
+    {
+        trace.dropped++;
+        return;
+    }
+
+    Event& event = buffer->events[index];
+    event.name = name;
+    int64_t beginFromEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(begin.time_since_epoch()).count() - trace.epoch.load(std::memory_order_relaxed);
+    event.begin = beginFromEpoch > 0 ? static_cast<uint64_t>(beginFromEpoch) : 0;
+    event.duration = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    event.bytes = bytes;
+    event.detail[0] = '\0';
+    if (detail)
+    {
+        strncpy(event.detail, detail, sizeof(event.detail) - 1);
+        event.detail[sizeof(event.detail) - 1] = '\0';
+    }
+
+    buffer->size.store(index + 1, std::memory_order_release);
+#else
+    (void)name;
+    (void)begin;
+    (void)end;
+    (void)detail;
+    (void)bytes;
+#endif
+}
+
+void matioCpp::Tracing::writeChromeTrace(std::ostream &output)
+{
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+#ifdef MATIOCPP_ENABLE_TRACING
+    TraceState& trace = state();
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    bool first = true;
+    for (const std::shared_ptr<ThreadBuffer>& buffer : trace.buffers)
+    {
+        output << (first ? "\n" : ",\n")
+               << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex
+               << ",\"args\":{\"name\":\"matioCpp thread " << buffer->threadIndex << "\"}}";
+        first = false;
+
+        size_t size = buffer->size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const Event& event = buffer->events[i];
+            output << ",\n{\"name\":\"";
+            writeEscaped(output, event.name);
+            output << "\",\"cat\":\"matioCpp\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                   << ",\"ts\":" << event.begin / 1000 << "." << (event.begin % 1000) / 100 << (event.begin % 100) / 10 << event.begin % 10
+                   << ",\"dur\":" << event.duration / 1000 << "." << (event.duration % 1000) / 100 << (event.duration % 100) / 10 << event.duration % 10
+                   << ",\"args\":{\"detail\":\"";
+            writeEscaped(output, event.detail);
+            output << "\",\"bytes\":" << event.bytes << "}}";
+        }
+    }
+#endif
+    output << "\n]}\n";
+}
+
+bool matioCpp::Tracing::writeChromeTrace(const std::string &fileName)
+{
+    std::ofstream file(fileName);
+    if (!file.is_open())
+    {
+        std::cerr << "[ERROR][matioCpp::Tracing::writeChromeTrace] Failed to open " << fileName << "." << std::endl;
+        return false;
+    }
+
+    writeChromeTrace(file);
+    return file.good();
+}
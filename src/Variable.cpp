@@ -12,8 +12,12 @@
 #include <matioCpp/Struct.h>
 #include <matioCpp/StructArray.h>
 #include <matioCpp/Vector.h>
+#include <matioCpp/Statistics.h>
+#include <matioCpp/Tracing.h>
+#include <cstdlib>
 
-bool matioCpp::Variable::initializeVariable(const std::string& name, const VariableType& variableType, const ValueType& valueType, matioCpp::Span<const size_t> dimensions, void* data)
+bool matioCpp::Variable::initializeVariable(const std::string& name, const VariableType& variableType, const ValueType& valueType, matioCpp::Span<const size_t> dimensions, void* data,
+                                            matioCpp::DataOwnership dataOwnership, std::shared_ptr<void> dataOwner)
 {
     std::string errorPrefix = "[ERROR][matioCpp::Variable::createVar] ";
     if (name.empty())
@@ -47,20 +51,54 @@ bool matioCpp::Variable::initializeVariable(const std::string& name, const Varia
         flags = flags | matio_flags::MAT_F_LOGICAL;
     }
 
+    matioCpp::DeleteMode deleteMode = matioCpp::DeleteMode::Delete;
+
+    matioCpp::Statistics::ScopedOperation statistics(matioCpp::Statistics::Operation::VariableInitialization);
+
+    if (dataOwnership == matioCpp::DataOwnership::Borrow)
+    {
+        if ((variableType == matioCpp::VariableType::CellArray) ||
+            (variableType == matioCpp::VariableType::Struct) ||
+            (variableType == matioCpp::VariableType::StructArray))
+        {
+            std::cerr << errorPrefix << "Only the data of numeric and char variables can be borrowed." << std::endl;
+            return false;
+        }
+
+        size_t totalElements = 1;
+        for (size_t dim : dimensionsCopy)
+        {
+            totalElements *= dim;
+        }
+
+        if (!data && (totalElements > 0))
+        {
+            std::cerr << errorPrefix << "Cannot borrow a null pointer." << std::endl;
+            return false;
+        }
+
+        flags = flags | matio_flags::MAT_F_DONT_COPY_DATA;
+        deleteMode = matioCpp::DeleteMode::ShallowDelete; //The data belongs to the caller, hence only the matvar_t is freed
+    }
+    else
+    {
+        dataOwner.reset(); //The data is copied, hence there is no need to keep its owner alive
+    }
+
     matvar_t* newPtr = Mat_VarCreate(name.c_str(), matioClass, matioType, static_cast<int>(dimensionsCopy.size()), dimensionsCopy.data(), data, flags);
 
     if (m_handler)
     {
-        if (!m_handler->importMatvar(newPtr))
+        if (!m_handler->importMatvar(newPtr, deleteMode, dataOwner))
         {
             std::cerr << errorPrefix << "Failed to modify the variable." << std::endl;
-            MatvarHandler::DeleteMatvar(newPtr);
+            MatvarHandler::DeleteMatvar(newPtr, deleteMode);
             return false;
         }
     }
     else
     {
-        m_handler = new matioCpp::SharedMatvar(newPtr);
+        m_handler = new matioCpp::SharedMatvar(newPtr, deleteMode, dataOwner);
     }
 
     if (!m_handler || !m_handler->get())
@@ -69,6 +107,8 @@ bool matioCpp::Variable::initializeVariable(const std::string& name, const Varia
         return false;
     }
 
+    statistics.addData((data && (dataOwnership == matioCpp::DataOwnership::Copy)) ? newPtr->nbytes : 0, 1);
+
     return true;
 }
 
@@ -177,6 +217,188 @@ size_t matioCpp::Variable::getArrayNumberOfElements() const
     return totalElements;
 }
 
+bool matioCpp::Variable::resizeArray(matioCpp::Span<const size_t> newDimensions)
+{
+    std::string errorPrefix = "[ERROR][matioCpp::Variable::resizeArray] ";
+    if (!isValid())
+    {
+        std::cerr << errorPrefix << "The variable is not valid." << std::endl;
+        return false;
+    }
+
+    if (!m_handler->isShared())
+    {
+        std::cerr << errorPrefix << "Cannot resize the variable if it is not owning the memory." << std::endl;
+        return false;
+    }
+
+    if (newDimensions.size() < 2)
+    {
+        std::cerr << errorPrefix << "The dimensions should be at least 2." << std::endl;
+        return false;
+    }
+
+    matvar_t* array = m_handler->get();
+    if ((array->class_type != matio_classes::MAT_C_CELL) && (array->class_type != matio_classes::MAT_C_STRUCT))
+    {
+        std::cerr << errorPrefix << "Only cell arrays and struct arrays can be resized." << std::endl;
+        return false;
+    }
+
+    //Each element of a struct array is a block of pointers, one for each field
+    size_t blockSize = (array->class_type == matio_classes::MAT_C_STRUCT) ? Mat_VarGetNumberOfFields(array) : 1;
+    size_t blockBytes = blockSize * sizeof(matvar_t*);
+
+    size_t oldRank = static_cast<size_t>(array->rank);
+    size_t newRank = static_cast<size_t>(newDimensions.size());
+    size_t rank = std::max(oldRank, newRank);
+    std::vector<size_t> oldDimensions(rank, 1);
+    std::vector<size_t> paddedNewDimensions(rank, 1);
+    size_t oldElements = 1;
+    size_t newElements = 1;
+    for (size_t i = 0; i < rank; ++i)
+    {
+        if (i < oldRank)
+        {
+            oldDimensions[i] = array->dims[i];
+        }
+        if (i < newRank)
+        {
+            paddedNewDimensions[i] = newDimensions[i];
+        }
+        oldElements *= oldDimensions[i];
+        newElements *= paddedNewDimensions[i];
+    }
+
+    //First allocate the memory, so that nothing is changed in case of failure
+    size_t capacity = (blockBytes > 0) ? array->nbytes / blockBytes : newElements;
+    if ((blockBytes > 0) && (newElements > capacity))
+    {
+        size_t newCapacity = std::max(newElements, 2 * capacity);
+        if (!m_handler->reallocateData(newCapacity * blockBytes))
+        {
+            std::cerr << errorPrefix << "Failed to allocate the space for " << newElements << " elements." << std::endl;
+            return false;
+        }
+        capacity = newCapacity;
+
+        //The spare capacity is always set to null
+        matvar_t** reallocatedTable = static_cast<matvar_t**>(array->data);
+        std::fill(reallocatedTable + oldElements * blockSize, reallocatedTable + capacity * blockSize, nullptr);
+    }
+
+    if (newRank != oldRank)
+    {
+        size_t* newDims = static_cast<size_t*>(realloc(array->dims, newRank * sizeof(size_t))); //The dimensions of matio variables are allocated with malloc
+        if (!newDims)
+        {
+            std::cerr << errorPrefix << "Failed to allocate the dimensions." << std::endl;
+            return false;
+        }
+        array->dims = newDims;
+        array->rank = static_cast<int>(newRank);
+    }
+
+    matvar_t** table = static_cast<matvar_t**>(array->data);
+
+    //The linear position of the kept elements does not change if only the last dimension (ignoring trailing singletons) changes
+    size_t lastDimension = rank - 1;
+    while ((lastDimension > 0) && (oldDimensions[lastDimension] == 1) && (paddedNewDimensions[lastDimension] == 1))
+    {
+        lastDimension--;
+    }
+    bool samePositions = true;
+    for (size_t i = 0; i < lastDimension; ++i)
+    {
+        samePositions = samePositions && (oldDimensions[i] == paddedNewDimensions[i]);
+    }
+
+    auto deleteElement = [this](matvar_t* element)
+    {
+        if (element)
+        {
+            m_handler->dropOwnedPointer(element); //This avoids that any variable that was using this pointer before tries to access it.
+            MatvarHandler::DeleteMatvar(element);
+        }
+    };
+
+    if (samePositions || (oldElements == 0) || (newElements == 0))
+    {
+        for (size_t i = newElements * blockSize; i < oldElements * blockSize; ++i)
+        {
+            deleteElement(table[i]);
+            table[i] = nullptr;
+        }
+    }
+    else if (blockSize > 0)
+    {
+        std::vector<matvar_t*> newTable(newElements * blockSize, nullptr);
+        std::vector<size_t> indices(rank, 0);
+        for (size_t oldIndex = 0; oldIndex < oldElements; ++oldIndex)
+        {
+            bool kept = true;
+            size_t newIndex = 0;
+            size_t stride = 1;
+            for (size_t i = 0; i < rank; ++i)
+            {
+                kept = kept && (indices[i] < paddedNewDimensions[i]);
+                newIndex += indices[i] * stride;
+                stride *= paddedNewDimensions[i];
+            }
+
+            for (size_t field = 0; field < blockSize; ++field)
+            {
+                if (kept)
+                {
+                    newTable[newIndex * blockSize + field] = table[oldIndex * blockSize + field];
+                }
+                else
+                {
+                    deleteElement(table[oldIndex * blockSize + field]);
+                }
+            }
+
+            for (size_t i = 0; (i < rank) && (++indices[i] == oldDimensions[i]); ++i)
+            {
+                indices[i] = 0;
+            }
+        }
+
+        std::copy(newTable.begin(), newTable.end(), table);
+        std::fill(table + newElements * blockSize, table + capacity * blockSize, nullptr);
+    }
+
+    std::copy(newDimensions.begin(), newDimensions.end(), array->dims);
+
+    return true;
+}
+
+bool matioCpp::Variable::appendArrayElements(size_t numberOfElements)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::appendArrayElements] The variable is not valid." << std::endl;
+        return false;
+    }
+
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    if ((currentDimensions.size() != 2) || ((currentDimensions[0] > 1) && (currentDimensions[1] > 1)))
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::appendArrayElements] Elements can be appended only to arrays with one row or one column." << std::endl;
+        return false;
+    }
+
+    size_t currentSize = getArrayNumberOfElements();
+    size_t newDimensions[] = {1, currentSize + numberOfElements};
+    if ((currentDimensions[1] == 1) && (currentDimensions[0] != 1)) //Column
+    {
+        newDimensions[0] = currentSize + numberOfElements;
+        newDimensions[1] = 1;
+    }
+
+    return resizeArray(newDimensions);
+}
+
 bool matioCpp::Variable::setCellElement(size_t linearIndex, const matioCpp::Variable &newValue)
 {
     if (!isValid())
@@ -208,14 +430,40 @@ bool matioCpp::Variable::setCellElement(size_t linearIndex, const matioCpp::Vari
     return Mat_VarGetCell(m_handler->get(), static_cast<int>(linearIndex));
 }
 
+bool matioCpp::Variable::setCellElement(size_t linearIndex, matioCpp::Variable &&newValue)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::setCellElement] The variable is not valid." << std::endl;
+        return false;
+    }
+
+    matvar_t* released = releaseMatvar(newValue);
+    if (!released)
+    {
+        return setCellElement(linearIndex, static_cast<const Variable&>(newValue));
+    }
+
+    Variable movedNonOwning(matioCpp::WeakMatvar(released, m_handler));
+
+    matvar_t* previousCell = Mat_VarSetCell(m_handler->get(), static_cast<int>(linearIndex), movedNonOwning.toMatio());
+
+    m_handler->dropOwnedPointer(previousCell); //This avoids that any variable that was using this pointer before tries to access it.
+    MatvarHandler::DeleteMatvar(previousCell);
+
+    return Mat_VarGetCell(m_handler->get(), static_cast<int>(linearIndex));
+}
+
 matioCpp::Variable matioCpp::Variable::getCellElement(size_t linearIndex)
 {
+    matioCpp::Tracing::ScopedEvent event("CellArray element access");
     assert(isValid());
     return Variable(matioCpp::WeakMatvar(Mat_VarGetCell(m_handler->get(), static_cast<int>(linearIndex)), m_handler));
 }
 
 const matioCpp::Variable matioCpp::Variable::getCellElement(size_t linearIndex) const
 {
+    matioCpp::Tracing::ScopedEvent event("CellArray element access");
     assert(isValid());
     return Variable(matioCpp::WeakMatvar(Mat_VarGetCell(m_handler->get(), static_cast<int>(linearIndex)), m_handler));
 }
@@ -232,26 +480,25 @@ char * const * matioCpp::Variable::getStructFields() const
     return Mat_VarGetStructFieldnames(m_handler->get());
 }
 
-bool matioCpp::Variable::getStructFieldIndex(const std::string& field, size_t& index) const
+matvar_t *matioCpp::Variable::releaseMatvar(Variable &other)
 {
-    size_t i = 0;
-    size_t numberOfFields = getStructNumberOfFields();
-    char * const * fields = getStructFields();
-    index = numberOfFields;
-
-    if (!fields)
+    if (!other.isValid())
     {
-        return false;
+        return nullptr;
     }
 
-    while (i < numberOfFields && (strcmp(fields[i], field.c_str()) != 0))
-    {
-        ++i;
-    }
+    return other.m_handler->releaseMatvar();
+}
 
-    index = i;
+bool matioCpp::Variable::reallocateData(size_t bytes)
+{
+    return m_handler && m_handler->reallocateData(bytes);
+}
 
-    return index < numberOfFields;
+bool matioCpp::Variable::getStructFieldIndex(const std::string& field, size_t& index) const
+{
+    assert(isValid());
+    return m_handler->getStructFieldIndex(field, index);
 }
 
 bool matioCpp::Variable::setStructField(size_t index, const matioCpp::Variable &newValue, size_t structPositionInArray)
@@ -282,6 +529,36 @@ bool matioCpp::Variable::setStructField(size_t index, const matioCpp::Variable &
     return Mat_VarGetStructFieldByIndex(m_handler->get(), index, structPositionInArray);
 }
 
+bool matioCpp::Variable::setStructField(size_t index, matioCpp::Variable &&newValue, size_t structPositionInArray)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::setStructField] The variable is not valid." << std::endl;
+        return false;
+    }
+
+    if (!m_handler->isShared())
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::setStructField] Cannot set the field if the variable is not owning the memory." << std::endl;
+        return false;
+    }
+
+    matvar_t* released = releaseMatvar(newValue);
+    if (!released)
+    {
+        return setStructField(index, static_cast<const Variable&>(newValue), structPositionInArray);
+    }
+
+    Variable movedNonOwning(matioCpp::WeakMatvar(released, m_handler));
+
+    matvar_t* previousField = Mat_VarSetStructFieldByIndex(m_handler->get(), index, structPositionInArray, movedNonOwning.toMatio());
+
+    m_handler->dropOwnedPointer(previousField); //This avoids that any variable that was using this pointer before tries to access it.
+    MatvarHandler::DeleteMatvar(previousField);
+
+    return Mat_VarGetStructFieldByIndex(m_handler->get(), index, structPositionInArray);
+}
+
 bool matioCpp::Variable::addStructField(const std::string &newField)
 {
     if (!isValid())
@@ -293,6 +570,7 @@ bool matioCpp::Variable::addStructField(const std::string &newField)
     if (m_handler->isShared()) //This means that the variable is not part of an array
     {
         int err = Mat_VarAddStructField(m_handler->get(), newField.c_str());
+        m_handler->invalidateStructFieldIndex();
 
         if (err)
         {
@@ -307,6 +585,106 @@ bool matioCpp::Variable::addStructField(const std::string &newField)
     return true;
 }
 
+bool matioCpp::Variable::setStructFields(std::vector<matioCpp::Variable> &&newValues)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::setStructFields] The variable is not valid." << std::endl;
+        return false;
+    }
+
+    if (!m_handler->isShared() || (getArrayNumberOfElements() != 1)) //The fields can be added only if the variable is not part of an array
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::setStructFields] Cannot set the fields if the variable is not owning the memory or if it is an array." << std::endl;
+        return false;
+    }
+
+    //First check all the inputs, so that nothing is changed in case of failure
+    const size_t notReplaced = newValues.size();
+    size_t numberOfFields = getStructNumberOfFields();
+    std::vector<size_t> replacements(numberOfFields, notReplaced);
+    std::vector<size_t> appended;
+    std::unordered_set<std::string> appendedNames;
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        if (!newValues[i].isValid())
+        {
+            std::cerr << "[ERROR][matioCpp::Variable::setStructFields] The element at index "<< i << " (0-based) is not valid." << std::endl;
+            return false;
+        }
+
+        std::string fieldName = newValues[i].name();
+        size_t index;
+        bool repeated;
+        if (getStructFieldIndex(fieldName, index))
+        {
+            repeated = replacements[index] != notReplaced;
+            replacements[index] = i;
+        }
+        else
+        {
+            repeated = !appendedNames.insert(fieldName).second;
+            appended.push_back(i);
+        }
+
+        if (repeated)
+        {
+            std::cerr << "[ERROR][matioCpp::Variable::setStructFields] The field " << fieldName << " is set more than once." << std::endl;
+            return false;
+        }
+    }
+
+    //The new values are taken before modifying the struct, since they could refer to one of its fields
+    std::vector<matvar_t*> newPointers(newValues.size(), nullptr);
+    for (size_t i = 0; i < newValues.size(); ++i)
+    {
+        newPointers[i] = releaseMatvar(newValues[i]);
+        if (!newPointers[i])
+        {
+            newPointers[i] = matioCpp::MatvarHandler::GetMatvarDuplicate(newValues[i].toMatio());
+        }
+    }
+
+    std::string structName = name();
+    matioCpp::Span<const size_t> currentDimensions = dimensions();
+    std::vector<size_t> structDimensions(currentDimensions.begin(), currentDimensions.end());
+    std::vector<matvar_t*> fields(numberOfFields + appended.size() + 1, nullptr); //The vector of pointers has to be null terminated
+
+    matvar_t* released = releaseMatvar(*this);
+    for (size_t field = 0; field < numberOfFields; ++field)
+    {
+        if (replacements[field] != notReplaced)
+        {
+            fields[field] = newPointers[replacements[field]];
+        }
+        else if (released)
+        {
+            //Take the field and leave only the replaced ones in the released struct, so that they are deleted together with it
+            fields[field] = Mat_VarGetStructFieldByIndex(released, field, 0);
+            static_cast<matvar_t**>(released->data)[field] = nullptr;
+        }
+        else
+        {
+            fields[field] = matioCpp::MatvarHandler::GetMatvarDuplicate(Mat_VarGetStructFieldByIndex(m_handler->get(), field, 0));
+        }
+    }
+
+    for (size_t i = 0; i < appended.size(); ++i)
+    {
+        fields[numberOfFields + i] = newPointers[appended[i]];
+    }
+
+    if (released)
+    {
+        MatvarHandler::DeleteMatvar(released);
+    }
+
+    return initializeVariable(structName,
+                              VariableType::Struct,
+                              matioCpp::ValueType::VARIABLE, structDimensions,
+                              fields.data());
+}
+
 bool matioCpp::Variable::setStructField(const std::string& field, const matioCpp::Variable &newValue, size_t structPositionInArray)
 {
     if (!isValid())
@@ -327,6 +705,24 @@ bool matioCpp::Variable::setStructField(const std::string& field, const matioCpp
     return setStructField(fieldindex, newValue, structPositionInArray);
 }
 
+bool matioCpp::Variable::setStructField(const std::string& field, matioCpp::Variable &&newValue, size_t structPositionInArray)
+{
+    if (!isValid())
+    {
+        std::cerr << "[ERROR][matioCpp::Variable::setStructField] The variable is not valid." << std::endl;
+        return false;
+    }
+
+    size_t fieldindex;
+
+    if (!getStructFieldIndex(field, fieldindex) && !((getArrayNumberOfElements() == 1) && addStructField(field)))
+    {
+        return false;
+    }
+
+    return setStructField(fieldindex, std::move(newValue), structPositionInArray);
+}
+
 matioCpp::Variable matioCpp::Variable::getStructField(size_t index, size_t structPositionInArray)
 {
     assert(isValid());
@@ -397,7 +793,7 @@ matioCpp::Variable::Variable(const matioCpp::Variable &other)
     }
 }
 
-matioCpp::Variable::Variable(matioCpp::Variable &&other)
+matioCpp::Variable::Variable(matioCpp::Variable &&other) noexcept
 {
     m_handler = other.m_handler;
     other.m_handler = nullptr;
@@ -478,9 +874,28 @@ bool matioCpp::Variable::fromOther(matioCpp::Variable &&other)
     }
     m_handler = other.m_handler;
     other.m_handler = nullptr;
+    m_dataCache.generation.store(0, std::memory_order_release);
     return isValid();
 }
 
+const matvar_t *matioCpp::Variable::refreshDataCache() const
+{
+    const std::atomic<uint64_t>* counter = m_handler ? m_handler->generation() : nullptr;
+    if (!counter)
+    {
+        return m_handler ? m_handler->get() : nullptr;
+    }
+
+    // The generation is read before querying the handler, so that a change happening in between invalidates the cache.
+    // It is stored last, so that a thread reading it sees also the corresponding pointers.
+    uint64_t generation = counter->load(std::memory_order_relaxed);
+    matvar_t* matvar = m_handler->get();
+    m_dataCache.data.store(matvar ? matvar->data : nullptr, std::memory_order_relaxed);
+    m_dataCache.matvar.store(matvar, std::memory_order_relaxed);
+    m_dataCache.generation.store(generation, std::memory_order_release);
+    return matvar;
+}
+
 const matvar_t *matioCpp::Variable::toMatio() const
 {
     assert(isValid());
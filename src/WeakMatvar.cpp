@@ -31,6 +31,7 @@ matioCpp::WeakMatvar::WeakMatvar(const SharedMatvar &other)
    matioCpp::WeakMatvar otherWeak = other.weakOwnership();
    m_ownership = otherWeak.m_ownership;
    m_ptr = otherWeak.m_ptr;
+   m_generation = otherWeak.m_generation;
 }
 
 matioCpp::WeakMatvar::WeakMatvar(matvar_t *inputPtr, const SharedMatvar &owner, DeleteMode mode)
@@ -38,6 +39,7 @@ matioCpp::WeakMatvar::WeakMatvar(matvar_t *inputPtr, const SharedMatvar &owner,
     , m_ownership(owner.ownership())
 
 {
+    m_generation = owner.weakOwnership().m_generation;
     auto locked = m_ownership.lock();
     if (locked)
     {
@@ -47,8 +49,10 @@ matioCpp::WeakMatvar::WeakMatvar(matvar_t *inputPtr, const SharedMatvar &owner,
 
 matioCpp::WeakMatvar::WeakMatvar(matvar_t *inputPtr, const matioCpp::MatvarHandler *owner, DeleteMode mode)
 {
-    m_ownership = owner->weakOwnership().m_ownership;
+    matioCpp::WeakMatvar ownerWeak = owner->weakOwnership();
+    m_ownership = ownerWeak.m_ownership;
     m_ptr = std::make_shared<PointerInfo>(inputPtr, mode);
+    m_generation = ownerWeak.m_generation;
 
     auto locked = m_ownership.lock();
     if (locked)
@@ -89,7 +93,7 @@ bool matioCpp::WeakMatvar::duplicateMatvar(const matvar_t *)
     return false;
 }
 
-bool matioCpp::WeakMatvar::importMatvar(matvar_t *)
+bool matioCpp::WeakMatvar::importMatvar(matvar_t *, DeleteMode, std::shared_ptr<void>)
 {
     std::cerr << "[ERROR][matioCpp::WeakMatvar::importMatvar] Cannot import inputPtr. A WeakMatvar cannot modify the matvar pointer." << std::endl;
 
@@ -115,10 +119,21 @@ void matioCpp::WeakMatvar::dropOwnedPointer(matvar_t *previouslyOwnedPointer)
     }
 }
 
+matvar_t *matioCpp::WeakMatvar::releaseMatvar()
+{
+    return nullptr; //A WeakMatvar never owns the pointer
+}
+
+std::shared_ptr<matioCpp::MatvarHandler::Ownership> matioCpp::WeakMatvar::lockOwnership() const
+{
+    return m_ownership.lock();
+}
+
 matioCpp::WeakMatvar &matioCpp::WeakMatvar::operator=(const matioCpp::WeakMatvar &other)
 {
     m_ownership = other.m_ownership;
     m_ptr = other.m_ptr;
+    m_generation = other.m_generation;
     return *this;
 }
 
@@ -126,6 +141,7 @@ matioCpp::WeakMatvar &matioCpp::WeakMatvar::operator=(matioCpp::WeakMatvar &&oth
 {
     m_ownership = other.m_ownership;
     m_ptr = other.m_ptr;
+    m_generation = other.m_generation;
     return *this;
 }
 
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <matioCpp/matioCpp.h>
+
+TEST_CASE("Write in order")
+{
+    matioCpp::File::Delete("testAsync.mat");
+    matioCpp::AsyncFileWriter writer(matioCpp::File::Create("testAsync.mat", matioCpp::FileVersion::MAT5), 4);
+    REQUIRE(writer.isOpen());
+
+    std::vector<std::future<bool>> results;
+    std::vector<std::string> names;
+    std::vector<double> data(100);
+    for (size_t i = 0; i < 20; ++i)
+    {
+        names.push_back("var" + std::to_string(i));
+        data[0] = static_cast<double>(i);
+        matioCpp::Vector<double> vector(names.back(), data);
+        results.push_back(writer.write(vector, matioCpp::Compression::zlib));
+        data[0] = -1.0; // The variable has been copied
+        vector(0) = -1.0;
+    }
+
+    results.push_back(writer.write(matioCpp::Element<int>("element", 5)));
+    names.push_back("element");
+
+    REQUIRE(writer.flush());
+    for (std::future<bool>& result : results)
+    {
+        REQUIRE(result.get());
+    }
+    REQUIRE(writer.queueSize() == 0);
+
+    REQUIRE_FALSE(writer.write(matioCpp::Element<int>("element", 5)).get()); // Already existing
+    REQUIRE_FALSE(writer.write(matioCpp::Variable()).get());
+    REQUIRE_FALSE(writer.flush());
+    REQUIRE(writer.flush());
+
+    matioCpp::File file = writer.close();
+    REQUIRE_FALSE(writer.isOpen());
+    REQUIRE_FALSE(writer.write(matioCpp::Element<int>("other", 5)).get());
+    REQUIRE_FALSE(writer.close().isOpen());
+
+    REQUIRE(file.isOpen());
+    REQUIRE(file.variableNames() == names);
+    for (size_t i = 0; i < 20; ++i)
+    {
+        REQUIRE(file.read(names[i]).asVector<double>()(0) == i);
+    }
+    REQUIRE(file.read("element").asElement<int>() == 5);
+}
+
+TEST_CASE("Queue full policies")
+{
+    const size_t numberOfVariables = 50;
+    std::vector<double> data(10000, 1.0);
+
+    SECTION("Drop")
+    {
+        matioCpp::File::Delete("testAsyncDrop.mat");
+        matioCpp::AsyncFileWriter writer(matioCpp::File::Create("testAsyncDrop.mat", matioCpp::FileVersion::MAT5),
+                                         1, matioCpp::QueueFullPolicy::Drop);
+
+        std::vector<std::future<bool>> results;
+        for (size_t i = 0; i < numberOfVariables; ++i)
+        {
+            results.push_back(writer.write(matioCpp::Vector<double>("var" + std::to_string(i), data), matioCpp::Compression::zlib));
+        }
+
+        size_t written = 0;
+        for (std::future<bool>& result : results)
+        {
+            written += result.get() ? 1 : 0;
+        }
+        REQUIRE(written + writer.droppedWrites() == numberOfVariables);
+        REQUIRE(writer.flush() == (writer.droppedWrites() == 0));
+
+        matioCpp::File file = writer.close();
+        REQUIRE(file.variableNames().size() == written);
+    }
+
+    SECTION("Block and grow")
+    {
+        for (matioCpp::QueueFullPolicy policy : {matioCpp::QueueFullPolicy::Block, matioCpp::QueueFullPolicy::Grow})
+        {
+            matioCpp::File::Delete("testAsyncBlock.mat");
+            {
+                matioCpp::AsyncFileWriter writer(matioCpp::File::Create("testAsyncBlock.mat", matioCpp::FileVersion::MAT5), 2, policy);
+
+                for (size_t i = 0; i < numberOfVariables; ++i)
+                {
+                    writer.write(matioCpp::Vector<double>("var" + std::to_string(i), data), matioCpp::Compression::zlib);
+                    if (policy == matioCpp::QueueFullPolicy::Block)
+                    {
+                        REQUIRE(writer.queueSize() <= 2);
+                    }
+                }
+            } // The destructor waits for all the variables to be written
+
+            matioCpp::File file("testAsyncBlock.mat", matioCpp::FileMode::ReadOnly);
+            REQUIRE(file.variableNames().size() == numberOfVariables);
+        }
+    }
+}
+
+TEST_CASE("Not writable file")
+{
+    matioCpp::AsyncFileWriter writer(matioCpp::File(), 4);
+    REQUIRE_FALSE(writer.isOpen());
+    REQUIRE_FALSE(writer.write(matioCpp::Element<int>("element", 5)).get());
+    REQUIRE_FALSE(writer.close().isOpen());
+
+    matioCpp::File::Delete("testAsyncReadOnly.mat");
+    matioCpp::File::Create("testAsyncReadOnly.mat", matioCpp::FileVersion::MAT5).close();
+    matioCpp::AsyncFileWriter readOnlyWriter(matioCpp::File("testAsyncReadOnly.mat", matioCpp::FileMode::ReadOnly), 4);
+    REQUIRE_FALSE(readOnlyWriter.isOpen());
+    matioCpp::File readOnlyFile = readOnlyWriter.close();
+    REQUIRE(readOnlyFile.isOpen());
+    REQUIRE(readOnlyFile.mode() == matioCpp::FileMode::ReadOnly);
+    REQUIRE_FALSE(readOnlyWriter.close().isOpen());
+}
+
+TEST_CASE("Write views")
+{
+    matioCpp::File::Delete("testAsyncViews.mat");
+    matioCpp::AsyncFileWriter writer(matioCpp::File::Create("testAsyncViews.mat", matioCpp::FileVersion::MAT5), 4);
+    REQUIRE(writer.isOpen());
+
+    std::future<bool> fieldResult;
+    {
+        std::vector<double> data(10000, 3.0);
+        matioCpp::Struct container("container", {matioCpp::Vector<double>("field", data)});
+        fieldResult = writer.write(container["field"], matioCpp::Compression::zlib);
+    } // The struct is destroyed while the field may still be queued
+
+    std::vector<double> ownedData(100, 4.0);
+    std::future<bool> ownedResult = writer.write(matioCpp::Vector<double>("owned", ownedData), matioCpp::Compression::zlib);
+
+    REQUIRE(writer.flush());
+    REQUIRE(fieldResult.get());
+    REQUIRE(ownedResult.get());
+
+    matioCpp::File file = writer.close();
+    matioCpp::Vector<double> field = file.read("field").asVector<double>();
+    REQUIRE(field.size() == 10000);
+    REQUIRE(field(9999) == 3.0);
+    REQUIRE(file.read("owned").asVector<double>()(99) == 4.0);
+}
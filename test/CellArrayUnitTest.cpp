@@ -140,6 +140,41 @@ TEST_CASE("Constructors")
                       matioCpp::ValueType::VARIABLE, false, {1,2,3});
     }
 
+    SECTION("Name, dimensions and moved data")
+    {
+        std::vector<matioCpp::Variable> data;
+        data.emplace_back(matioCpp::Vector<double>("vector", 4));
+        data.emplace_back(matioCpp::Element<int>("element", 3));
+        data.emplace_back(matioCpp::String("name", "content"));
+
+        matioCpp::SharedMatvar sharedMatvar(matioCpp::MatvarHandler::GetMatvarDuplicate(matioCpp::Vector<double>("shared", 3).toMatio()));
+        data.emplace_back(sharedMatvar);
+
+        std::vector<const matvar_t*> pointers;
+        for (const matioCpp::Variable& element : data)
+        {
+            pointers.push_back(element.toMatio());
+        }
+
+        matioCpp::CellArray var("test", {2,2}, std::move(data));
+
+        checkVariable(var, "test", matioCpp::VariableType::CellArray,
+                      matioCpp::ValueType::VARIABLE, false, {2,2});
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE_FALSE(data[i].isValid());
+            REQUIRE(var(i).toMatio() == pointers[i]);
+        }
+        REQUIRE(var(1).asElement<int>() == 3);
+        REQUIRE(var(2).asString()() == "content");
+
+        //The last element is shared with sharedMatvar, hence it is copied
+        REQUIRE(data[3].isValid());
+        REQUIRE(var(3).toMatio() != pointers[3]);
+        checkSameVariable(var(3), data[3]);
+    }
+
     SECTION("Copy constructor")
     {
         std::vector<matioCpp::Variable> data;
@@ -219,6 +254,29 @@ TEST_CASE("Indeces from raw index")
 
 }
 
+TEST_CASE("Indices iteration")
+{
+    matioCpp::CellArray var("test", {2,3,2});
+
+    for (const matioCpp::MultiIndex& index : var.indices())
+    {
+        REQUIRE(var.setElement(index.indices(), matioCpp::Element<size_t>("element", index.rawIndex())));
+    }
+
+    for (const matioCpp::MultiIndex& index : var.indices())
+    {
+        REQUIRE(var(index).asElement<size_t>() == index.rawIndex());
+        REQUIRE(var[index].toMatio() == var(index[0], index[1], index[2]).toMatio());
+        REQUIRE(var.rawIndexFromIndices(std::array<size_t, 3>{{index[0], index[1], index[2]}}) == index.rawIndex());
+    }
+
+    REQUIRE(var(1, 2, 1).asElement<size_t>() == 11);
+    REQUIRE(var(std::array<size_t, 3>{{1, 0, 1}}).asElement<size_t>() == 7);
+    const matioCpp::CellArray& constVar = var;
+    REQUIRE(constVar(0, 1, 0).asElement<size_t>() == 2);
+    REQUIRE(constVar[std::array<size_t, 3>{{0, 2, 1}}].asElement<size_t>() == 10);
+}
+
 TEST_CASE("Assignments")
 {
     std::vector<matioCpp::Variable> data;
@@ -295,6 +353,20 @@ TEST_CASE("Assignments")
         checkSameCellArray(in, imported);
     }
 
+    SECTION("From vector of Variables (move)")
+    {
+        matioCpp::CellArray imported("test");
+        std::vector<matioCpp::Variable> copiedData = data;
+        REQUIRE(imported.fromVectorOfVariables({1,2,3}, std::move(copiedData)));
+        checkSameCellArray(in, imported);
+        REQUIRE_FALSE(copiedData[0].isValid());
+
+        std::vector<matioCpp::Variable> notValid(2);
+        notValid[0] = data[0];
+        REQUIRE_FALSE(imported.fromVectorOfVariables({1,2}, std::move(notValid)));
+        REQUIRE(notValid[0].isValid());
+    }
+
     Mat_VarFree(matioVar);
 }
 
@@ -346,7 +418,150 @@ TEST_CASE("Modifications")
     REQUIRE(in(4).asString()() == "anotherString");
     REQUIRE_FALSE(previousElement.isValid());
 
+    matioCpp::Vector<double> movedVector("moved", vectorIn);
+    const matvar_t* movedPointer = movedVector.toMatio();
+    previousElement = in(3);
+    REQUIRE(in.setElement(3, std::move(movedVector)));
+    REQUIRE_FALSE(movedVector.isValid());
+    REQUIRE_FALSE(previousElement.isValid());
+    REQUIRE(in(3).toMatio() == movedPointer);
+    checkSameVector(in(3).asVector<double>(), vectorIn);
+
+    REQUIRE(in.setElement({0,1,2}, in(3)));
+    REQUIRE(in(5).toMatio() != in(3).toMatio());
+    checkSameVector(in(5).asVector<double>(), vectorIn);
+
     in.clear();
     REQUIRE(in.numberOfElements() == 0);
 }
 
+
+TEST_CASE("Growth")
+{
+    SECTION("Resize")
+    {
+        std::vector<matioCpp::Variable> data;
+        data.emplace_back(matioCpp::Element<int>("e0", 0));
+        data.emplace_back(matioCpp::Element<int>("e1", 1));
+        data.emplace_back(matioCpp::Element<int>("e2", 2));
+        data.emplace_back(matioCpp::Element<int>("e3", 3));
+
+        matioCpp::CellArray cell("cell", {2,2}, data);
+        const matvar_t* pointer01 = cell({0,1}).toMatio();
+        matioCpp::Variable view11 = cell({1,1});
+
+        cell.resize({3,3});
+        REQUIRE(cell.numberOfElements() == 9);
+        REQUIRE(cell.dimensions()(0) == 3);
+        REQUIRE(cell.dimensions()(1) == 3);
+        REQUIRE(cell({0,0}).asElement<int>() == 0);
+        REQUIRE(cell({1,0}).asElement<int>() == 1);
+        REQUIRE(cell({0,1}).asElement<int>() == 2);
+        REQUIRE(cell({0,1}).toMatio() == pointer01);
+        REQUIRE(view11.isValid());
+        REQUIRE(view11.asElement<int>() == 3);
+        REQUIRE_FALSE(cell({2,2}).isValid());
+        REQUIRE_FALSE(cell({2,0}).isValid());
+
+        cell.resize({1,2});
+        REQUIRE(cell.numberOfElements() == 2);
+        REQUIRE(cell(0).asElement<int>() == 0);
+        REQUIRE(cell(1).asElement<int>() == 2);
+        REQUIRE_FALSE(view11.isValid());
+
+        cell.resize({1,2,2});
+        REQUIRE(cell.dimensions().size() == 3);
+        REQUIRE(cell({0,1,0}).asElement<int>() == 2);
+        REQUIRE(cell.numberOfElements() == 4);
+    }
+
+    SECTION("Push back")
+    {
+        matioCpp::CellArray cell("cell");
+        REQUIRE(cell.numberOfElements() == 0);
+
+        matioCpp::Element<double> element("element", 3.0);
+        REQUIRE(cell.push_back(element));
+        REQUIRE(element.isValid());
+
+        std::vector<double> vectorIn = {1.0, 2.0, 3.0};
+        matioCpp::Vector<double> moved("moved", vectorIn);
+        const matvar_t* movedPointer = moved.toMatio();
+        REQUIRE(cell.push_back(std::move(moved)));
+        REQUIRE_FALSE(moved.isValid());
+
+        matioCpp::Variable firstElement = cell(0);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(cell.push_back(matioCpp::Element<int>("e" + std::to_string(i), i)));
+        }
+
+        REQUIRE(cell.dimensions()(0) == 1);
+        REQUIRE(cell.dimensions()(1) == 102);
+        REQUIRE(cell(0).asElement<double>() == 3.0);
+        REQUIRE(cell(1).toMatio() == movedPointer);
+        checkSameVector(cell(1).asVector<double>(), vectorIn);
+        REQUIRE(firstElement.isValid());
+        REQUIRE(firstElement.asElement<double>() == 3.0);
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(cell(i + 2).asElement<int>() == i);
+        }
+
+        REQUIRE_FALSE(cell.push_back(matioCpp::Variable()));
+        REQUIRE(cell.numberOfElements() == 102);
+
+        matioCpp::CellArray matrix("matrix", {2,2});
+        REQUIRE_FALSE(matrix.push_back(element));
+        REQUIRE(matrix.numberOfElements() == 4);
+    }
+
+    SECTION("Append")
+    {
+        matioCpp::CellArray column("column", {2,1});
+        std::vector<matioCpp::Variable> data;
+        data.emplace_back(matioCpp::Element<int>("e0", 0));
+        data.emplace_back(matioCpp::String("s1", "one"));
+
+        REQUIRE(column.append(data));
+        REQUIRE(data[0].isValid());
+        REQUIRE(column.dimensions()(0) == 4);
+        REQUIRE(column.dimensions()(1) == 1);
+        REQUIRE(column(2).asElement<int>() == 0);
+        REQUIRE(column(3).asString()() == "one");
+
+        REQUIRE(column.append(std::move(data)));
+        REQUIRE(column.numberOfElements() == 6);
+        REQUIRE(column(5).asString()() == "one");
+
+        std::vector<matioCpp::Variable> invalid;
+        invalid.emplace_back(matioCpp::Element<int>("e0", 0));
+        invalid.emplace_back(matioCpp::Variable());
+        REQUIRE_FALSE(column.append(invalid));
+        REQUIRE_FALSE(column.append(std::move(invalid)));
+        REQUIRE(column.numberOfElements() == 6);
+        REQUIRE(column.dimensions()(0) == 6);
+    }
+
+    SECTION("Write")
+    {
+        matioCpp::CellArray cell("cell");
+        for (int i = 0; i < 10; ++i)
+        {
+            REQUIRE(cell.push_back(matioCpp::Element<int>("e" + std::to_string(i), i)));
+        }
+
+        matioCpp::File file = matioCpp::File::Create("testCellArrayGrowth.mat");
+        REQUIRE(file.isOpen());
+        REQUIRE(file.write(cell));
+
+        matioCpp::CellArray read = file.read("cell").asCellArray();
+        REQUIRE(read.isValid());
+        REQUIRE(read.numberOfElements() == 10);
+        for (int i = 0; i < 10; ++i)
+        {
+            REQUIRE(read(i).asElement<int>() == i);
+        }
+    }
+}
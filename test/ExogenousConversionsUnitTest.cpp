@@ -189,6 +189,12 @@ TEST_CASE("Exogenous conversions")
         auto toMatioVec = matioCpp::make_variable("test", stdVec);
         checkSameVectors(stdVec, toMatioVec);
 
+        std::vector<double> movedVec = stdVec;
+        const double* movedData = movedVec.data();
+        auto toMatioMovedVec = matioCpp::make_variable("test", std::move(movedVec));
+        REQUIRE(toMatioMovedVec.data() == movedData);
+        checkSameVectors(stdVec, toMatioMovedVec);
+
         std::array<float,3> array = {1.0, 2.0, 3.0};
         auto toMatioArray = matioCpp::make_variable("test", array);
         checkSameVectors(array, toMatioArray);
@@ -274,6 +280,24 @@ TEST_CASE("Exogenous conversions")
         REQUIRE(ok);
     }
 
+    SECTION("Struct with repeated keys")
+    {
+        std::vector<std::pair<std::string, int>> pairs = {{"a", 1}, {"b", 2}, {"a", 3}};
+
+        matioCpp::Struct toMatio = matioCpp::make_struct("pairs", pairs.begin(), pairs.end());
+
+        REQUIRE(toMatio.isValid());
+        REQUIRE(toMatio.numberOfFields() == 2);
+        REQUIRE(toMatio.fields() == std::vector<std::string>({"a", "b"}));
+        REQUIRE(toMatio["a"].asElement<int>() == 3);
+        REQUIRE(toMatio["b"].asElement<int>() == 2);
+
+        std::multimap<std::string, double> multimap = {{"x", 1.0}, {"x", 2.0}};
+        matioCpp::Struct fromMultimap = matioCpp::make_struct("multimap", multimap.begin(), multimap.end());
+        REQUIRE(fromMultimap.numberOfFields() == 1);
+        REQUIRE(fromMultimap["x"].asElement<double>() == 2.0);
+    }
+
     SECTION("Cell Array")
     {
         std::map<std::string, char> map;
@@ -9,6 +9,39 @@
 #include <matioCpp/matioCpp.h>
 #include "MatFolderPath.h"
 
+namespace
+{
+// Iterator returning the variables by value, like a transform iterator
+class ByValueIterator
+{
+    size_t m_index;
+
+public:
+
+    ByValueIterator(size_t index)
+        : m_index(index)
+    {
+    }
+
+    matioCpp::Variable operator*() const
+    {
+        std::vector<double> data(100, static_cast<double>(m_index));
+        return matioCpp::Vector<double>("vector" + std::to_string(m_index), data);
+    }
+
+    ByValueIterator& operator++()
+    {
+        ++m_index;
+        return *this;
+    }
+
+    bool operator!=(const ByValueIterator& other) const
+    {
+        return m_index != other.m_index;
+    }
+};
+}
+
 TEST_CASE("Default constructor / open /close file")
 {
     matioCpp::File input;
@@ -370,6 +403,379 @@ TEST_CASE("Batch write")
     dataMap.insert(std::make_pair("name", matioCpp::String("name", "content")));
 
     REQUIRE(file2.write(dataMap.cbegin(), dataMap.cend()));
+
+
+    matioCpp::File::Delete("testBatchByValue.mat");
+    matioCpp::File file3 = matioCpp::File::Create("testBatchByValue.mat");
+
+    REQUIRE(file3.write(ByValueIterator(0), ByValueIterator(4)));
+    REQUIRE(file3.variableNames().size() == 4);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        matioCpp::Vector<double> vector = file3.read("vector" + std::to_string(i)).asVector<double>();
+        REQUIRE(vector.size() == 100);
+        REQUIRE(vector(99) == i);
+    }
+}
+
+TEST_CASE("Batch write compressed")
+{
+    matioCpp::File::Delete("testBatchCompressed.mat");
+    matioCpp::File file = matioCpp::File::Create("testBatchCompressed.mat", matioCpp::FileVersion::MAT5);
+
+    REQUIRE(file.write(matioCpp::Element<double>("first", 1.0), matioCpp::Compression::zlib));
+
+    // The batch has to be large enough to be compressed in parallel
+    const size_t vectorSize = 20000;
+    std::vector<matioCpp::Variable> dataVector;
+    std::vector<std::string> expectedNames({"first"});
+    for (size_t i = 0; i < 8; ++i)
+    {
+        std::vector<double> data(vectorSize, static_cast<double>(i));
+        dataVector.emplace_back(matioCpp::Vector<double>("vector" + std::to_string(i), data));
+        expectedNames.push_back(dataVector.back().name());
+    }
+    std::vector<matioCpp::Variable> fields;
+    fields.emplace_back(matioCpp::String("text", "content"));
+    fields.emplace_back(matioCpp::Element<int>("integer", 3));
+    dataVector.emplace_back(matioCpp::Struct("struct", fields));
+    expectedNames.push_back("struct");
+    std::vector<matioCpp::Variable> cellElements;
+    cellElements.emplace_back(matioCpp::Element<double>("element", 7.0));
+    cellElements.emplace_back(matioCpp::String("string", "cell"));
+    dataVector.emplace_back(matioCpp::CellArray("cell", {1,2}, cellElements));
+    expectedNames.push_back("cell");
+
+    REQUIRE(file.write(dataVector.begin(), dataVector.end(), matioCpp::Compression::zlib));
+    REQUIRE(file.isOpen());
+    REQUIRE(file.variableNames() == expectedNames);
+    REQUIRE(file.read("vector3").asVector<double>()(vectorSize - 1) == 3.0);
+
+    REQUIRE_FALSE(file.write(dataVector.begin(), dataVector.end(), matioCpp::Compression::zlib));
+    REQUIRE(file.write(matioCpp::Element<double>("last", 2.0)));
+    expectedNames.push_back("last");
+
+    file.close();
+    REQUIRE(file.open("testBatchCompressed.mat"));
+    REQUIRE(file.variableNames() == expectedNames);
+    REQUIRE(file.read("first").asElement<double>() == 1.0);
+    for (size_t i = 0; i < 8; ++i)
+    {
+        matioCpp::Vector<double> vector = file.read("vector" + std::to_string(i)).asVector<double>();
+        REQUIRE(vector.size() == vectorSize);
+        REQUIRE(vector(0) == i);
+        REQUIRE(vector(vectorSize - 1) == i);
+    }
+    matioCpp::Struct readStruct = file.read("struct").asStruct();
+    REQUIRE(readStruct.isValid());
+    REQUIRE(readStruct("text").asString()() == "content");
+    REQUIRE(readStruct("integer").asElement<int>() == 3);
+    matioCpp::CellArray readCell = file.read("cell").asCellArray();
+    REQUIRE(readCell.isValid());
+    REQUIRE(readCell({0,0}).asElement<double>() == 7.0);
+    REQUIRE(readCell({0,1}).asString()() == "cell");
+    REQUIRE(file.read("last").asElement<double>() == 2.0);
+}
+
+TEST_CASE("Write borrowed data")
+{
+    matioCpp::File::Delete("testBorrowed.mat");
+    matioCpp::File file = matioCpp::File::Create("testBorrowed.mat");
+
+    std::vector<double> buffer = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    matioCpp::Vector<double> vector("vector", matioCpp::make_span(buffer), matioCpp::DataOwnership::Borrow);
+    matioCpp::MultiDimensionalArray<double> array("array", {2, 3}, buffer.data(), matioCpp::DataOwnership::Borrow);
+
+    REQUIRE(file.write(vector));
+    REQUIRE(file.write(array, matioCpp::Compression::zlib));
+    REQUIRE(vector.data() == buffer.data());
+
+    matioCpp::Vector<double> readVector = file.read("vector").asVector<double>();
+    REQUIRE(readVector.size() == buffer.size());
+    matioCpp::MultiDimensionalArray<double> readArray = file.read("array").asMultiDimensionalArray<double>();
+    REQUIRE(readArray.numberOfElements() == buffer.size());
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+        REQUIRE(readVector(i) == buffer[i]);
+        REQUIRE(readArray(i) == buffer[i]);
+    }
+}
+
+void checkPartialRead(matioCpp::FileVersion version)
+{
+    matioCpp::File::Delete("testPartial.mat");
+    matioCpp::File file = matioCpp::File::Create("testPartial.mat", version);
+
+    matioCpp::MultiDimensionalArray<double> matrixInput("matrix", {4,5});
+    for (size_t i = 0; i < 4; ++i)
+    {
+        for (size_t j = 0; j < 5; ++j)
+        {
+            matrixInput({i,j}) = i + 10.0 * j;
+        }
+    }
+    REQUIRE(file.write(matrixInput));
+    REQUIRE(file.write(matioCpp::String("string", "test")));
+
+    matioCpp::MultiDimensionalArray<double> slab = file.read("matrix", {1, 0}, {2, 2}, {2, 3}).asMultiDimensionalArray<double>();
+    REQUIRE(slab.isValid());
+    REQUIRE(slab.name() == "matrix");
+    REQUIRE(slab.dimensions()[0] == 2);
+    REQUIRE(slab.dimensions()[1] == 3);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            REQUIRE(slab({i,j}) == (1 + 2 * i) + 10.0 * (2 * j));
+        }
+    }
+
+    matioCpp::Vector<double> column = file.read("matrix", {0, 3}, {1, 1}, {4, 1}).asVector<double>();
+    REQUIRE(column.isValid());
+    REQUIRE(column.size() == 4);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        REQUIRE(column(i) == i + 30.0);
+    }
+
+    matioCpp::Vector<double> linear = file.readLinear("matrix", 2, 4, 5).asVector<double>();
+    REQUIRE(linear.isValid());
+    REQUIRE(linear.size() == 5);
+    for (size_t i = 0; i < 5; ++i)
+    {
+        REQUIRE(linear(i) == 2.0 + 10.0 * i);
+    }
+
+    REQUIRE_FALSE(file.read("matrix", {3, 0}, {2, 1}, {2, 1}).isValid());
+    REQUIRE_FALSE(file.read("matrix", {0}, {1}, {1}).isValid());
+    REQUIRE_FALSE(file.read("matrix", {0, 0}, {0, 1}, {1, 1}).isValid());
+    REQUIRE_FALSE(file.readLinear("matrix", 19, 1, 2).isValid());
+    REQUIRE_FALSE(file.read("notExisting", {0, 0}, {1, 1}, {1, 1}).isValid());
+    REQUIRE_FALSE(file.read("string", {0, 0}, {1, 1}, {1, 1}).isValid());
+}
+
+TEST_CASE("Read by name in any order")
+{
+    matioCpp::File::Delete("testIndex.mat");
+    matioCpp::File file = matioCpp::File::Create("testIndex.mat", matioCpp::FileVersion::MAT5);
+
+    const int numberOfVariables = 20;
+    for (int i = 0; i < numberOfVariables; ++i)
+    {
+        REQUIRE(file.write(matioCpp::Element<int>("var" + std::to_string(i), i)));
+    }
+    file.close();
+
+    REQUIRE(file.open("testIndex.mat"));
+    std::vector<std::string> names = file.variableNames();
+    REQUIRE(names.size() == numberOfVariables);
+    for (int i = 0; i < numberOfVariables; ++i)
+    {
+        REQUIRE(names[i] == "var" + std::to_string(i));
+    }
+
+    for (int i = 0; i < numberOfVariables; ++i)
+    {
+        REQUIRE(file.read("var" + std::to_string(i)).asElement<int>()() == i);
+    }
+
+    for (int i = numberOfVariables - 1; i >= 0; i -= 3)
+    {
+        REQUIRE(file.read("var" + std::to_string(i)).asElement<int>()() == i);
+    }
+
+    REQUIRE(file.read("var7").asElement<int>()() == 7);
+    REQUIRE(file.read("var7").asElement<int>()() == 7);
+    REQUIRE_FALSE(file.read("notExisting").isValid());
+
+    REQUIRE(file.write(matioCpp::Element<int>("added", 42)));
+    names = file.variableNames();
+    REQUIRE(names.size() == numberOfVariables + 1);
+    REQUIRE(names.back() == "added");
+    REQUIRE(file.read("var3").asElement<int>()() == 3);
+    REQUIRE(file.read("added").asElement<int>()() == 42);
+}
+
+TEST_CASE("Read many")
+{
+    matioCpp::File::Delete("testMany.mat");
+    matioCpp::File file = matioCpp::File::Create("testMany.mat", matioCpp::FileVersion::MAT5);
+
+    const size_t numberOfVariables = 12;
+    std::vector<std::string> names;
+    for (size_t i = 0; i < numberOfVariables; ++i)
+    {
+        std::vector<double> data(1000, static_cast<double>(i));
+        names.push_back("var" + std::to_string(i));
+        REQUIRE(file.write(matioCpp::Vector<double>(names.back(), data), matioCpp::Compression::zlib));
+    }
+
+    std::vector<std::string> requested({"var5", "var0", "notExisting", "var11", "var5", "var3"});
+
+    std::vector<matioCpp::Variable> afterWrite = file.readMany(requested, 4);
+    REQUIRE(afterWrite.size() == requested.size());
+    REQUIRE(afterWrite[0].asVector<double>()(999) == 5.0);
+
+    file.close();
+    REQUIRE(file.open("testMany.mat", matioCpp::FileMode::ReadOnly));
+
+    std::vector<matioCpp::Variable> variables = file.readMany(requested, 4);
+    REQUIRE(variables.size() == requested.size());
+    REQUIRE_FALSE(variables[2].isValid());
+
+    std::vector<size_t> expected({5, 0, 0, 11, 5, 3});
+    for (size_t i = 0; i < requested.size(); ++i)
+    {
+        if (i == 2)
+        {
+            continue;
+        }
+        REQUIRE(variables[i].isValid());
+        REQUIRE(variables[i].name() == requested[i]);
+        matioCpp::Vector<double> vector = variables[i].asVector<double>();
+        REQUIRE(vector.size() == 1000);
+        REQUIRE(vector(0) == expected[i]);
+        REQUIRE(vector(999) == expected[i]);
+    }
+
+    std::vector<matioCpp::Variable> all = file.readMany(names);
+    REQUIRE(all.size() == numberOfVariables);
+    for (size_t i = 0; i < numberOfVariables; ++i)
+    {
+        REQUIRE(all[i].asVector<double>()(10) == i);
+    }
+
+    REQUIRE(file.readMany({}).empty());
+}
+
+TEST_CASE("Read mapped")
+{
+    matioCpp::File::Delete("testMapped.mat");
+    matioCpp::File file = matioCpp::File::Create("testMapped.mat", matioCpp::FileVersion::MAT5);
+
+    std::vector<double> vectorData(1000);
+    for (size_t i = 0; i < vectorData.size(); ++i)
+    {
+        vectorData[i] = 0.5 * i;
+    }
+    REQUIRE(file.write(matioCpp::Vector<double>("vector", vectorData)));
+    std::vector<int32_t> matrixData({1, 2, 3, 4, 5, 6});
+    REQUIRE(file.write(matioCpp::MultiDimensionalArray<int32_t>("matrix", {2, 3}, matrixData.data())));
+    std::vector<bool> boolData({true, false, true});
+    REQUIRE(file.write(matioCpp::Vector<matioCpp::Logical>("logical", boolData)));
+    REQUIRE(file.write(matioCpp::Element<uint8_t>("small", 7)));
+    REQUIRE(file.write(matioCpp::Vector<double>("compressed", vectorData), matioCpp::Compression::zlib));
+    REQUIRE(file.write(matioCpp::String("text", "content")));
+
+    REQUIRE_FALSE(file.readMapped("vector").isValid()); // The file has been written
+
+    file.close();
+    REQUIRE(file.open("testMapped.mat"));
+
+    matioCpp::Vector<double> vector = file.readMapped("vector").asVector<double>();
+    REQUIRE(vector.isValid());
+    REQUIRE(vector.size() == vectorData.size());
+    REQUIRE(vector(999) == vectorData[999]);
+
+    matioCpp::MultiDimensionalArray<int32_t> matrix = file.readMapped("matrix").asMultiDimensionalArray<int32_t>();
+    REQUIRE(matrix.isValid());
+    REQUIRE(matrix.dimensions()(0) == 2);
+    REQUIRE(matrix.dimensions()(1) == 3);
+    REQUIRE(matrix({1, 2}) == 6);
+
+    matioCpp::Vector<matioCpp::Logical> logical = file.readMapped("logical").asVector<matioCpp::Logical>();
+    REQUIRE(logical.isValid());
+    REQUIRE(logical(0));
+    REQUIRE_FALSE(logical(1));
+
+    REQUIRE(file.readMapped("small").asElement<uint8_t>() == 7);
+
+    REQUIRE_FALSE(file.readMapped("compressed").isValid());
+    REQUIRE_FALSE(file.readMapped("text").isValid());
+    REQUIRE_FALSE(file.readMapped("notExisting").isValid());
+
+    vector(0) = 10.0;
+    REQUIRE(file.read("vector").asVector<double>()(0) == 0.0);
+
+    file.close();
+    REQUIRE(vector(999) == vectorData[999]); // The mapping outlives the file
+    REQUIRE(matrix({0, 1}) == 3);
+
+    matioCpp::File::Delete("testMapped4.mat");
+    matioCpp::File file4 = matioCpp::File::Create("testMapped4.mat", matioCpp::FileVersion::MAT4);
+    REQUIRE(file4.write(matioCpp::Vector<double>("vector", vectorData)));
+    file4.close();
+    REQUIRE(file4.open("testMapped4.mat"));
+    REQUIRE_FALSE(file4.readMapped("vector").isValid());
+}
+
+TEST_CASE("Variable info and schema")
+{
+    matioCpp::File::Delete("testInfo.mat");
+    matioCpp::File file = matioCpp::File::Create("testInfo.mat", matioCpp::FileVersion::MAT5);
+
+    REQUIRE(file.write(matioCpp::MultiDimensionalArray<double>("matrix", {2,3,4})));
+    REQUIRE(file.write(matioCpp::Vector<int32_t>("vector", 5), matioCpp::Compression::zlib));
+
+    std::vector<matioCpp::Variable> fields;
+    fields.emplace_back(matioCpp::Element<double>("element", 3.0));
+    fields.emplace_back(matioCpp::String("string", "content"));
+    REQUIRE(file.write(matioCpp::Struct("struct", fields)));
+
+    std::vector<matioCpp::Variable> cellElements;
+    cellElements.emplace_back(matioCpp::Vector<uint8_t>("vector", 3));
+    cellElements.emplace_back(matioCpp::Element<matioCpp::Logical>("logical", true));
+    REQUIRE(file.write(matioCpp::CellArray("cell", {1,2}, cellElements)));
+
+    matioCpp::VariableInfo matrixInfo = file.info("matrix");
+    REQUIRE(matrixInfo.isValid());
+    REQUIRE(matrixInfo.name == "matrix");
+    REQUIRE(matrixInfo.variableType == matioCpp::VariableType::MultiDimensionalArray);
+    REQUIRE(matrixInfo.valueType == matioCpp::ValueType::DOUBLE);
+    REQUIRE(matrixInfo.dimensions == std::vector<size_t>({2,3,4}));
+    REQUIRE_FALSE(matrixInfo.isComplex);
+    REQUIRE(matrixInfo.numberOfElements() == 24);
+    REQUIRE(matrixInfo.estimatedBytes == 24 * sizeof(double));
+    REQUIRE(matrixInfo.children.empty());
+
+    matioCpp::VariableInfo vectorInfo = file.info("vector");
+    REQUIRE(vectorInfo.isValid());
+    REQUIRE(vectorInfo.variableType == matioCpp::VariableType::Vector);
+    REQUIRE(vectorInfo.valueType == matioCpp::ValueType::INT32);
+
+    matioCpp::VariableInfo structInfo = file.info("struct");
+    REQUIRE(structInfo.isValid());
+    REQUIRE(structInfo.variableType == matioCpp::VariableType::Struct);
+    REQUIRE(structInfo.children.size() == 2);
+    REQUIRE(structInfo.children[0].name == "element");
+    REQUIRE(structInfo.children[0].variableType == matioCpp::VariableType::Element);
+    REQUIRE(structInfo.children[1].name == "string");
+    REQUIRE(structInfo.children[1].dimensions == std::vector<size_t>({1,7}));
+    REQUIRE(structInfo.estimatedBytes >= sizeof(double) + 7);
+
+    matioCpp::VariableInfo cellInfo = file.info("cell");
+    REQUIRE(cellInfo.isValid());
+    REQUIRE(cellInfo.variableType == matioCpp::VariableType::CellArray);
+    REQUIRE(cellInfo.children.size() == 2);
+    REQUIRE(cellInfo.children[0].valueType == matioCpp::ValueType::UINT8);
+    REQUIRE(cellInfo.children[1].valueType == matioCpp::ValueType::LOGICAL);
+
+    REQUIRE_FALSE(file.info("notExisting").isValid());
+
+    std::vector<matioCpp::VariableInfo> schema = file.schema();
+    REQUIRE(schema.size() == 4);
+    REQUIRE(schema[0].name == "matrix");
+    REQUIRE(schema[1].name == "vector");
+    REQUIRE(schema[2].name == "struct");
+    REQUIRE(schema[2].children.size() == 2);
+    REQUIRE(schema[3].name == "cell");
+
+    REQUIRE(file.read("vector").isValid());
+}
+
+TEST_CASE("Partial read version 5")
+{
+    checkPartialRead(matioCpp::FileVersion::MAT5);
 }
 
 #if !defined(_MSC_VER) || MATIO_VERSION >= 1519 //Reading from a MAT7.3 file on Windows with a matio version lower than 1.5.19 causes segfaults
@@ -494,6 +900,82 @@ TEST_CASE("Write version 7.3")
 //    REQUIRE(readStructArrayVar.isValid());
 //    REQUIRE(readStructArrayVar(0)("element").asElement<int>()() == 3);
 }
+
+TEST_CASE("Partial read version 7.3")
+{
+    checkPartialRead(matioCpp::FileVersion::MAT7_3);
+}
+
+#if MATIO_VERSION >= 1513
+TEST_CASE("Appendable variable")
+{
+    matioCpp::File::Delete("testAppend.mat");
+    matioCpp::File file = matioCpp::File::Create("testAppend.mat", matioCpp::FileVersion::MAT7_3);
+
+    REQUIRE(file.createAppendable("signal", matioCpp::ValueType::DOUBLE, 3, 4));
+    REQUIRE_FALSE(file.createAppendable("signal", matioCpp::ValueType::DOUBLE, 3, 4));
+    REQUIRE_FALSE(file.createAppendable("text", matioCpp::ValueType::UTF8, 3, 4));
+    REQUIRE_FALSE(file.createAppendable("empty", matioCpp::ValueType::DOUBLE, 0, 4));
+
+    std::vector<double> rows;
+    for (size_t i = 0; i < 30; ++i)
+    {
+        rows.push_back(static_cast<double>(i));
+    }
+
+    REQUIRE_FALSE(file.appendRows("signal", matioCpp::make_span(rows).subspan(0, 2)));
+    REQUIRE_FALSE(file.appendRows("notExisting", matioCpp::make_span(rows)));
+    std::vector<int> intRows(3, 0);
+    REQUIRE_FALSE(file.appendRows("signal", matioCpp::make_span(intRows)));
+
+    REQUIRE(file.appendRows("signal", matioCpp::make_span(rows).subspan(0, 3))); // One row, buffered
+    REQUIRE(file.appendRows("signal", matioCpp::make_span(rows).subspan(3, 18))); // Six rows, one chunk written
+    REQUIRE(file.appendRows("signal", matioCpp::make_span(rows).subspan(21, 9))); // Three rows, the second chunk is written
+
+    matioCpp::MultiDimensionalArray<double> flushed = file.read("signal").asMultiDimensionalArray<double>();
+    REQUIRE(flushed.isValid());
+    REQUIRE(flushed.dimensions()[0] == 8);
+    REQUIRE(flushed.dimensions()[1] == 3);
+
+    REQUIRE_FALSE(file.write(matioCpp::Vector<double>("signal", 3)));
+
+    REQUIRE(file.closeAppendable("signal"));
+    REQUIRE_FALSE(file.appendRows("signal", matioCpp::make_span(rows).subspan(0, 3)));
+
+    matioCpp::MultiDimensionalArray<double> signal = file.read("signal").asMultiDimensionalArray<double>();
+    REQUIRE(signal.isValid());
+    REQUIRE(signal.dimensions()[0] == 10);
+    REQUIRE(signal.dimensions()[1] == 3);
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            REQUIRE(signal({i, j}) == rows[3 * i + j]);
+        }
+    }
+
+    REQUIRE_FALSE(file.createAppendable("signal", matioCpp::ValueType::DOUBLE, 3, 4));
+
+    REQUIRE(file.createAppendable("flags", matioCpp::ValueType::LOGICAL, 2));
+    std::vector<uint8_t> flags({1, 0, 0, 1});
+    REQUIRE(file.appendRows("flags", matioCpp::make_span(flags)));
+    file.close();
+
+    REQUIRE(file.open("testAppend.mat"));
+    matioCpp::MultiDimensionalArray<matioCpp::Logical> readFlags = file.read("flags").asMultiDimensionalArray<matioCpp::Logical>();
+    REQUIRE(readFlags.isValid());
+    REQUIRE(readFlags.dimensions()[0] == 2);
+    REQUIRE(readFlags({0, 0}));
+    REQUIRE_FALSE(readFlags({0, 1}));
+    REQUIRE_FALSE(readFlags({1, 0}));
+    REQUIRE(readFlags({1, 1}));
+
+    matioCpp::File::Delete("test5Append.mat");
+    matioCpp::File file5 = matioCpp::File::Create("test5Append.mat", matioCpp::FileVersion::MAT5);
+    REQUIRE_FALSE(file5.createAppendable("signal", matioCpp::ValueType::DOUBLE, 3));
+}
+#endif
 #endif
 
 TEST_CASE("Write version 4")
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+#include <matioCpp/matioCpp.h>
+
+TEST_CASE("Constructors")
+{
+    std::vector<double> data(24);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<double>(i);
+    }
+
+    matioCpp::MultiDimensionalArray<double> array("array", {2,3,4}, data.data());
+
+    SECTION("Default")
+    {
+        matioCpp::FixedRankView<double, 2> view;
+        REQUIRE_FALSE(view.isValid());
+        REQUIRE(view.numberOfElements() == 0);
+    }
+
+    SECTION("From MultiDimensionalArray")
+    {
+        matioCpp::FixedRankView<double, 3> view(array);
+        REQUIRE(view.isValid());
+        static_assert(matioCpp::FixedRankView<double, 3>::rank() == 3, "The rank should be known at compile time.");
+        REQUIRE(view.dimensions()[0] == 2);
+        REQUIRE(view.dimensions()[1] == 3);
+        REQUIRE(view.dimensions()[2] == 4);
+        REQUIRE(view.strides()[0] == 1);
+        REQUIRE(view.strides()[1] == 2);
+        REQUIRE(view.strides()[2] == 6);
+        REQUIRE(view.numberOfElements() == 24);
+        REQUIRE(view.data() == array.data());
+        REQUIRE(view.toSpan().size() == 24);
+    }
+
+    SECTION("From Variable")
+    {
+        matioCpp::Variable variable = array;
+        matioCpp::FixedRankView<double, 3> view(variable);
+        REQUIRE(view.isValid());
+        REQUIRE(view.data() == static_cast<double*>(variable.toMatio()->data));
+
+        const matioCpp::Variable& constVariable = variable;
+        matioCpp::FixedRankView<const double, 3> constView(constVariable);
+        REQUIRE(constView.isValid());
+        REQUIRE(constView(1, 2, 3) == 23.0);
+    }
+
+    SECTION("From a field of a struct")
+    {
+        matioCpp::Struct container("container", {array});
+        matioCpp::Variable field = container("array");
+        matioCpp::FixedRankView<double, 3> view(field);
+        REQUIRE(view.isValid());
+        view(1, 1, 1) = -1.0;
+        REQUIRE(container("array").asMultiDimensionalArray<double>()({1,1,1}) == -1.0);
+    }
+
+    SECTION("Vectors and elements")
+    {
+        matioCpp::Vector<int> vector("vector", 5);
+        matioCpp::FixedRankView<int, 2> vectorView(vector);
+        REQUIRE(vectorView.isValid());
+        REQUIRE(vectorView.numberOfElements() == 5);
+        vectorView(0, 4) = 7;
+        REQUIRE(vector(4) == 7);
+
+        matioCpp::FixedRankView<int, 1> linearView(vector);
+        REQUIRE_FALSE(linearView.isValid());
+
+        matioCpp::Element<int> element("element", 3);
+        matioCpp::FixedRankView<int, 3> elementView(element);
+        REQUIRE(elementView.isValid());
+        REQUIRE(elementView.dimensions()[2] == 1);
+        REQUIRE(elementView(0, 0, 0) == 3);
+    }
+
+    SECTION("Rank")
+    {
+        matioCpp::FixedRankView<double, 4> higherRank(array);
+        REQUIRE(higherRank.isValid());
+        REQUIRE(higherRank.dimensions()[3] == 1);
+        REQUIRE(higherRank(1, 2, 3, 0) == 23.0);
+
+        matioCpp::FixedRankView<double, 2> lowerRank(array);
+        REQUIRE_FALSE(lowerRank.isValid());
+
+        matioCpp::MultiDimensionalArray<double> singleton("singleton", {2,3,1});
+        matioCpp::FixedRankView<double, 2> droppedSingleton(singleton);
+        REQUIRE(droppedSingleton.isValid());
+        REQUIRE(droppedSingleton.numberOfElements() == 6);
+    }
+
+    SECTION("Incompatible variables")
+    {
+        matioCpp::Variable variable = array;
+        matioCpp::FixedRankView<float, 3> wrongType(variable);
+        REQUIRE_FALSE(wrongType.isValid());
+
+        matioCpp::CellArray cell("cell", {2,3,4});
+        matioCpp::FixedRankView<double, 3> cellView(cell);
+        REQUIRE_FALSE(cellView.isValid());
+
+        matioCpp::Variable invalid;
+        matioCpp::FixedRankView<double, 3> invalidView(invalid);
+        REQUIRE_FALSE(invalidView.isValid());
+    }
+}
+
+TEST_CASE("Access")
+{
+    matioCpp::MultiDimensionalArray<double> array("array", {3,4,5});
+    for (size_t i = 0; i < array.numberOfElements(); ++i)
+    {
+        array(i) = static_cast<double>(i);
+    }
+
+    matioCpp::FixedRankView<double, 3> view(array);
+    REQUIRE(view.isValid());
+
+    for (const matioCpp::MultiIndex& index : array.indices())
+    {
+        std::array<size_t, 3> el = {{index[0], index[1], index[2]}};
+        REQUIRE(view.rawIndexFromIndices(el) == index.rawIndex());
+        REQUIRE(view(index[0], index[1], index[2]) == array(index));
+        REQUIRE(view(el) == array(index));
+        REQUIRE(view[el] == array(index));
+        REQUIRE(view(index) == array(index));
+        REQUIRE(view[index] == array(index));
+    }
+
+    view(2, 3, 4) = -1.0;
+    REQUIRE(array({2,3,4}) == -1.0);
+
+    const matioCpp::MultiDimensionalArray<double>& constArray = array;
+    matioCpp::FixedRankView<const double, 3> constView(constArray);
+    REQUIRE(constView.isValid());
+    REQUIRE(constView(2, 3, 4) == -1.0);
+
+    matioCpp::FixedRankView<const double, 3> fromNonConst(array);
+    REQUIRE(fromNonConst.data() == constView.data());
+
+    matioCpp::MultiDimensionalArray<matioCpp::Logical> logical("logical", {2,2});
+    matioCpp::FixedRankView<matioCpp::Logical, 2> logicalView(logical);
+    REQUIRE(logicalView.isValid());
+    logicalView(1, 1) = 1;
+    REQUIRE(logical({1,1}));
+}
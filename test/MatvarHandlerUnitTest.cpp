@@ -316,3 +316,59 @@ TEST_CASE("Weak ownership register with multiple dependencies")
     REQUIRE_FALSE(weakWeak.get());
 }
 
+
+TEST_CASE("Weak ownership register with many dependencies")
+{
+    std::vector<double> vec(7);
+    std::vector<size_t> dimensions = {vec.size(), 1};
+    auto createVariable = [&]()
+    {
+        return Mat_VarCreate("test", matio_classes::MAT_C_DOUBLE, matio_types::MAT_T_DOUBLE, static_cast<int>(dimensions.size()), dimensions.data(), vec.data(), 0);
+    };
+
+    matioCpp::SharedMatvar shared(createVariable());
+    std::vector<matioCpp::WeakMatvar> children;
+    std::vector<matioCpp::WeakMatvar> grandChildren;
+    const size_t numberOfChildren = 500;
+
+    for (size_t i = 0; i < numberOfChildren; ++i)
+    {
+        children.emplace_back(createVariable(), shared, matioCpp::DeleteMode::Delete);
+        grandChildren.emplace_back(createVariable(), &children.back(), matioCpp::DeleteMode::Delete);
+        grandChildren.emplace_back(createVariable(), &children.back(), matioCpp::DeleteMode::Delete);
+    }
+
+    for (size_t i = 0; i < numberOfChildren; i += 2)
+    {
+        shared.dropOwnedPointer(children[i].get());
+    }
+
+    for (size_t i = 0; i < numberOfChildren; ++i)
+    {
+        bool dropped = (i % 2) == 0;
+        REQUIRE((children[i].get() == nullptr) == dropped);
+        REQUIRE((grandChildren[2 * i].get() == nullptr) == dropped);
+        REQUIRE((grandChildren[2 * i + 1].get() == nullptr) == dropped);
+    }
+
+    shared.dropOwnedPointer(grandChildren[3].get()); //Dropping a grand child keeps its siblings and its parent
+    REQUIRE(children[1].get());
+    REQUIRE_FALSE(grandChildren[3].get());
+    REQUIRE(grandChildren[2].get());
+
+    std::vector<matioCpp::WeakMatvar> newChildren; //They reuse the dropped nodes
+    for (size_t i = 0; i < numberOfChildren; ++i)
+    {
+        newChildren.emplace_back(createVariable(), shared, matioCpp::DeleteMode::Delete);
+        REQUIRE(newChildren.back().get());
+    }
+    REQUIRE(children[1].get());
+
+    shared.importMatvar(createVariable());
+
+    for (size_t i = 0; i < numberOfChildren; ++i)
+    {
+        REQUIRE_FALSE(children[i].get());
+        REQUIRE_FALSE(newChildren[i].get());
+    }
+}
@@ -134,6 +134,36 @@ TEST_CASE("Constructors")
                       matioCpp::ValueType::INT64, false, {1,2,3});
     }
 
+    SECTION("Name, dimensions and borrowed data")
+    {
+        std::vector<int64_t> data = {1, 2, 3, 4, 5, 6};
+        matioCpp::MultiDimensionalArray<int64_t> var("test", {1,2,3}, data.data(), matioCpp::DataOwnership::Borrow);
+
+        checkVariable(var, "test", matioCpp::VariableType::MultiDimensionalArray,
+                      matioCpp::ValueType::INT64, false, {1,2,3});
+        REQUIRE(var.data() == data.data());
+        REQUIRE(var({0,1,2}) == 6);
+
+        var({0,0,1}) = 7;
+        REQUIRE(data[2] == 7);
+
+        matioCpp::MultiDimensionalArray<int64_t> copy(var);
+        REQUIRE(copy.data() != data.data());
+        REQUIRE(copy({0,0,1}) == 7);
+    }
+
+    SECTION("Name, dimensions and moved data")
+    {
+        std::vector<double> data = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        const double* rawData = data.data();
+        matioCpp::MultiDimensionalArray<double> var("test", {2,3}, std::move(data));
+
+        checkVariable(var, "test", matioCpp::VariableType::MultiDimensionalArray,
+                      matioCpp::ValueType::DOUBLE, false, {2,3});
+        REQUIRE(var.data() == rawData);
+        REQUIRE(var({1,2}) == 6.0);
+    }
+
     SECTION("Copy constructor")
     {
         std::vector<char> data(6);
@@ -192,6 +222,59 @@ TEST_CASE("Indeces from raw index")
 
 }
 
+TEST_CASE("Indices iteration")
+{
+    matioCpp::MultiDimensionalArray<double> var("test", {3,4,5});
+    for (size_t i = 0; i < var.numberOfElements(); ++i)
+    {
+        var(i) = static_cast<double>(i);
+    }
+
+    size_t expectedRawIndex = 0;
+    std::vector<size_t> expectedIndices;
+    for (const matioCpp::MultiIndex& index : var.indices())
+    {
+        REQUIRE(index.rawIndex() == expectedRawIndex);
+        REQUIRE(index.size() == 3);
+        REQUIRE(var.indicesFromRawIndex(expectedRawIndex, expectedIndices));
+        REQUIRE(index.indices() == expectedIndices);
+        REQUIRE(var.rawIndexFromIndices(std::array<size_t, 3>{{index[0], index[1], index[2]}}) == expectedRawIndex);
+        REQUIRE(var(index) == static_cast<double>(expectedRawIndex));
+        REQUIRE(var[index] == var(index[0], index[1], index[2]));
+        expectedRawIndex++;
+    }
+    REQUIRE(expectedRawIndex == 60);
+    REQUIRE(var.indices().size() == 60);
+
+    var(2, 3, 4) = -1.0;
+    REQUIRE(var({2,3,4}) == -1.0);
+    std::array<size_t, 3> el = {{1, 2, 3}};
+    var[el] = -2.0;
+    REQUIRE(var(el) == -2.0);
+    REQUIRE(var(1, 2, 3) == -2.0);
+
+    const matioCpp::MultiDimensionalArray<double>& constVar = var;
+    REQUIRE(constVar(2, 3, 4) == -1.0);
+    REQUIRE(constVar[el] == -2.0);
+
+    matioCpp::Struct container("container", {var});
+    matioCpp::MultiDimensionalArray<double> field = container("test").asMultiDimensionalArray<double>();
+    REQUIRE(field(2, 3, 4) == -1.0);
+    field(1, 2, 3) = -3.0;
+    REQUIRE(container("test").asMultiDimensionalArray<double>()({1,2,3}) == -3.0);
+
+    matioCpp::MultiIndexIterator it = var.indices().begin();
+    matioCpp::MultiIndexIterator previous = it++;
+    REQUIRE(previous->rawIndex() == 0);
+    REQUIRE(it->rawIndex() == 1);
+    REQUIRE((*it)[0] == 1);
+    REQUIRE(previous != it);
+    REQUIRE(++previous == it);
+
+    matioCpp::MultiDimensionalArray<double> empty("empty");
+    REQUIRE(empty.indices().begin() == empty.indices().end());
+}
+
 TEST_CASE("Assignments")
 {
     std::vector<int> dataVec = {2,4,6,8};
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <matioCpp/matioCpp.h>
+
+using Operation = matioCpp::Statistics::Operation;
+
+TEST_CASE("Operation names")
+{
+    REQUIRE(matioCpp::Statistics::operationName(Operation::FileRead) == "FileRead");
+    REQUIRE(matioCpp::Statistics::operationName(Operation::FileWrite) == "FileWrite");
+    REQUIRE(matioCpp::Statistics::operationName(Operation::FileWriteCompressed) == "FileWriteCompressed");
+    REQUIRE(matioCpp::Statistics::operationName(Operation::VariableInitialization) == "VariableInitialization");
+    REQUIRE(matioCpp::Statistics::operationName(Operation::DeepCopy) == "DeepCopy");
+}
+
+TEST_CASE("Counters")
+{
+    matioCpp::Statistics::reset();
+
+    std::vector<double> data(100, 1.0);
+    matioCpp::Vector<double> vector("vector", data);
+    matioCpp::Vector<double> borrowed("borrowed", matioCpp::make_span(data), matioCpp::DataOwnership::Borrow);
+
+    std::vector<matioCpp::Variable> fields;
+    fields.emplace_back(vector);
+    fields.emplace_back(matioCpp::Element<int>("element", 3));
+    matioCpp::Struct structure("struct", fields);
+
+    matioCpp::Statistics::Snapshot afterCreation = matioCpp::Statistics::snapshot();
+
+    matioCpp::File::Delete("testStatistics.mat");
+    matioCpp::File file = matioCpp::File::Create("testStatistics.mat", matioCpp::FileVersion::MAT5);
+    REQUIRE(file.write(vector));
+    REQUIRE(file.write(structure, matioCpp::Compression::zlib));
+    REQUIRE_FALSE(file.write(vector)); // Failed operations are not counted
+    file.close();
+    REQUIRE(file.open("testStatistics.mat"));
+    REQUIRE(file.read("vector").isValid());
+    REQUIRE(file.read("struct").isValid());
+    REQUIRE_FALSE(file.read("notExisting").isValid());
+
+    matioCpp::Statistics::Snapshot afterFile = matioCpp::Statistics::snapshot();
+
+    if (!matioCpp::Statistics::isEnabled())
+    {
+        for (Operation operation : {Operation::FileRead, Operation::FileWrite, Operation::FileWriteCompressed,
+                                    Operation::VariableInitialization, Operation::DeepCopy})
+        {
+            REQUIRE(afterFile[operation].count == 0);
+            REQUIRE(afterFile[operation].bytes == 0);
+            REQUIRE(afterFile[operation].nodes == 0);
+            REQUIRE(afterFile[operation].nanoseconds == 0);
+        }
+        return;
+    }
+
+    REQUIRE(afterCreation[Operation::VariableInitialization].count >= 3);
+    REQUIRE(afterCreation[Operation::VariableInitialization].bytes >= 100 * sizeof(double));
+    REQUIRE(afterCreation[Operation::DeepCopy].count >= 2); // The fields of the struct are copied
+    REQUIRE(afterCreation[Operation::DeepCopy].bytes >= 100 * sizeof(double));
+
+    REQUIRE(afterFile[Operation::FileWrite].count == 1);
+    REQUIRE(afterFile[Operation::FileWrite].bytes == 100 * sizeof(double));
+    REQUIRE(afterFile[Operation::FileWrite].nodes == 1);
+    REQUIRE(afterFile[Operation::FileWriteCompressed].count == 1);
+    REQUIRE(afterFile[Operation::FileWriteCompressed].nodes == 3);
+    REQUIRE(afterFile[Operation::FileWriteCompressed].bytes == 100 * sizeof(double) + sizeof(int));
+    REQUIRE(afterFile[Operation::FileRead].count == 2);
+    REQUIRE(afterFile[Operation::FileRead].nodes == 4);
+    REQUIRE(afterFile[Operation::FileRead].bytes == 2 * 100 * sizeof(double) + sizeof(int));
+
+    matioCpp::Variable copy(structure);
+    matioCpp::Statistics::Snapshot afterCopy = matioCpp::Statistics::snapshot();
+    REQUIRE(afterCopy[Operation::DeepCopy].count == afterFile[Operation::DeepCopy].count + 1); // Nested copies are counted once
+    REQUIRE(afterCopy[Operation::DeepCopy].nodes == afterFile[Operation::DeepCopy].nodes + 3);
+
+    matioCpp::Statistics::reset();
+    matioCpp::Statistics::Snapshot afterReset = matioCpp::Statistics::snapshot();
+    REQUIRE(afterReset[Operation::FileRead].count == 0);
+    REQUIRE(afterReset[Operation::DeepCopy].nanoseconds == 0);
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+#include <matioCpp/matioCpp.h>
+
+namespace
+{
+matioCpp::MultiDimensionalArray<double> makeArray(const std::vector<size_t>& dimensions)
+{
+    size_t numberOfElements = 1;
+    for (size_t dim : dimensions)
+    {
+        numberOfElements *= dim;
+    }
+
+    std::vector<double> data(numberOfElements);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<double>(i);
+    }
+
+    return matioCpp::MultiDimensionalArray<double>("array", dimensions, data.data());
+}
+}
+
+TEST_CASE("Slice")
+{
+    matioCpp::Slice all;
+    REQUIRE(all.start() == 0);
+    REQUIRE(all.stop() == matioCpp::Slice::End);
+    REQUIRE(all.step() == 1);
+
+    matioCpp::Slice single(3);
+    REQUIRE(single.start() == 3);
+    REQUIRE(single.stop() == 4);
+    REQUIRE(single.step() == 1);
+
+    matioCpp::Slice range(1, 7, 2);
+    REQUIRE(range.start() == 1);
+    REQUIRE(range.stop() == 7);
+    REQUIRE(range.step() == 2);
+
+    REQUIRE(matioCpp::Slice::All().stop() == matioCpp::Slice::End);
+}
+
+TEST_CASE("Constructors")
+{
+    matioCpp::MultiDimensionalArray<double> array = makeArray({4,5,6});
+
+    SECTION("Default")
+    {
+        matioCpp::StridedView<double> view;
+        REQUIRE_FALSE(view.isValid());
+        REQUIRE(view.numberOfElements() == 0);
+    }
+
+    SECTION("From MultiDimensionalArray")
+    {
+        matioCpp::StridedView<double> view(array, {{1, 4, 2}, matioCpp::Slice::All(), 3});
+        REQUIRE(view.isValid());
+        REQUIRE(view.rank() == 3);
+        REQUIRE(view.dimensions() == std::vector<size_t>({2, 5, 1}));
+        REQUIRE(view.strides() == std::vector<size_t>({2, 4, 20}));
+        REQUIRE(view.numberOfElements() == 10);
+        REQUIRE(view.data() == array.data() + 1 + 3 * 20);
+    }
+
+    SECTION("Missing slices")
+    {
+        matioCpp::StridedView<double> view(array, {2});
+        REQUIRE(view.isValid());
+        REQUIRE(view.dimensions() == std::vector<size_t>({1, 5, 6}));
+        REQUIRE(view.numberOfElements() == 30);
+    }
+
+    SECTION("Const")
+    {
+        const matioCpp::MultiDimensionalArray<double>& constArray = array;
+        matioCpp::StridedView<const double> view(constArray, {{0, 4, 3}, {1, 5, 3}, {0, 6, 5}});
+        REQUIRE(view.isValid());
+        REQUIRE(view.dimensions() == std::vector<size_t>({2, 2, 2}));
+        REQUIRE(view(1, 1, 1) == array(3, 4, 5));
+    }
+
+    SECTION("Not valid")
+    {
+        REQUIRE_FALSE(matioCpp::StridedView<double>(array, {0, 0, 0, 0}).isValid());
+        REQUIRE_FALSE(matioCpp::StridedView<double>(array, {{0, 4, 0}}).isValid());
+        REQUIRE_FALSE(matioCpp::StridedView<double>(array, {{0, 5}}).isValid());
+        REQUIRE_FALSE(matioCpp::StridedView<double>(array, {4}).isValid());
+        REQUIRE_FALSE(matioCpp::StridedView<double>(array, {{3, 3}}).isValid());
+    }
+}
+
+TEST_CASE("Access")
+{
+    matioCpp::MultiDimensionalArray<double> array = makeArray({4,5,6,3});
+    matioCpp::StridedView<double> view(array, {{1, 4, 2}, {0, 5, 2}, 2, {0, 3}});
+    REQUIRE(view.isValid());
+    REQUIRE(view.dimensions() == std::vector<size_t>({2, 3, 1, 3}));
+
+    for (size_t l = 0; l < 3; ++l)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                double expected = array(1 + 2 * i, 2 * j, 2, l);
+                REQUIRE(view(i, j, 0, l) == expected);
+                REQUIRE(view({i, j, 0, l}) == expected);
+                REQUIRE(view[{i, j, 0, l}] == expected);
+            }
+        }
+    }
+
+    size_t visited = 0;
+    for (const matioCpp::MultiIndex& index : view.indices())
+    {
+        REQUIRE(view(index) == array(1 + 2 * index[0], 2 * index[1], 2, index[3]));
+        REQUIRE(view[index] == view(index.indices()));
+        visited++;
+    }
+    REQUIRE(visited == view.numberOfElements());
+
+    view(1, 2, 0, 2) = -1.0;
+    REQUIRE(array(3, 4, 2, 2) == -1.0);
+}
+
+TEST_CASE("copyTo")
+{
+    matioCpp::MultiDimensionalArray<double> array = makeArray({4,5,6,3,2});
+
+    auto checkCopy = [&array](const std::vector<matioCpp::Slice>& slices)
+    {
+        matioCpp::StridedView<const double> view(array, slices);
+        REQUIRE(view.isValid());
+
+        std::vector<double> output(view.numberOfElements());
+        REQUIRE(view.copyTo(matioCpp::make_span(output)));
+
+        size_t position = 0;
+        for (const matioCpp::MultiIndex& index : view.indices())
+        {
+            REQUIRE(output[position] == view(index));
+            position++;
+        }
+
+        matioCpp::MultiDimensionalArray<double> outputArray("output");
+        REQUIRE(view.copyTo(outputArray));
+        REQUIRE(outputArray.numberOfElements() == view.numberOfElements());
+        for (size_t i = 0; i < view.rank(); ++i)
+        {
+            REQUIRE(outputArray.dimensions()(i) == view.dimensions()[i]);
+        }
+        for (size_t i = 0; i < output.size(); ++i)
+        {
+            REQUIRE(outputArray.data()[i] == output[i]);
+        }
+    };
+
+    SECTION("Whole array")
+    {
+        checkCopy({});
+    }
+
+    SECTION("Contiguous leading dimensions")
+    {
+        checkCopy({matioCpp::Slice(), matioCpp::Slice(), {1, 5}, 2, 1});
+    }
+
+    SECTION("Strided first dimension")
+    {
+        checkCopy({{0, 4, 3}, {1, 5}, matioCpp::Slice(), {0, 3, 2}, matioCpp::Slice()});
+    }
+
+    SECTION("Single element")
+    {
+        checkCopy({3, 4, 5, 2, 1});
+    }
+
+    SECTION("Singleton first dimensions")
+    {
+        checkCopy({2, 3, {0, 6, 2}, matioCpp::Slice(), {1, 2}});
+    }
+
+    SECTION("Wrong size")
+    {
+        matioCpp::StridedView<const double> view(array, {2});
+        std::vector<double> output(view.numberOfElements() + 1);
+        REQUIRE_FALSE(view.copyTo(matioCpp::make_span(output)));
+
+        matioCpp::StridedView<const double> notValid;
+        REQUIRE_FALSE(notValid.copyTo(matioCpp::make_span(output)));
+
+        std::vector<matioCpp::Variable> fields;
+        fields.emplace_back(makeArray({2, 2}));
+        matioCpp::Struct container("container", fields);
+        matioCpp::MultiDimensionalArray<double> field = container("array").asMultiDimensionalArray<double>();
+        matioCpp::StridedView<const double> largeView(array, {matioCpp::Slice(), matioCpp::Slice(), 0, 0, 0});
+        REQUIRE_FALSE(largeView.copyTo(field));
+        REQUIRE(field.numberOfElements() == 4);
+        REQUIRE(field(1, 1) == 3.0);
+    }
+}
@@ -141,6 +141,57 @@ TEST_CASE("Constructors")
                       matioCpp::ValueType::VARIABLE, false, {1,2,3});
     }
 
+    SECTION("Name, dimensions and moved data")
+    {
+        std::vector<matioCpp::Variable> data;
+        data.emplace_back(matioCpp::Vector<double>("vector", std::vector<double>({1.0, 2.0, 3.0})));
+        data.emplace_back(matioCpp::Element<int>("element", 7));
+        data.emplace_back(matioCpp::String("name", "content"));
+
+        matioCpp::Struct structVar("test", data);
+
+        std::vector<matioCpp::Struct> structVector(4, structVar);
+        std::vector<const matvar_t*> fieldPointers;
+        for (const matioCpp::Struct& element : structVector)
+        {
+            fieldPointers.push_back(element("vector").toMatio());
+        }
+        matioCpp::Variable weakField = structVector[1]("element");
+        REQUIRE(weakField.isValid());
+
+        matioCpp::SharedMatvar sharedMatvar(matioCpp::MatvarHandler::GetMatvarDuplicate(structVar.toMatio()));
+        structVector[3] = matioCpp::Struct(sharedMatvar);
+        fieldPointers[3] = structVector[3]("vector").toMatio();
+
+        matioCpp::StructArray var("test", {2,2}, std::move(structVector));
+
+        checkVariable(var, "test", matioCpp::VariableType::StructArray,
+                      matioCpp::ValueType::VARIABLE, false, {2,2});
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE_FALSE(structVector[i].isValid());
+            REQUIRE(var[i]("vector").toMatio() == fieldPointers[i]);
+            REQUIRE(var[i]("element").asElement<int>()() == 7);
+        }
+        REQUIRE_FALSE(weakField.isValid());
+
+        //The last element is shared with sharedMatvar, hence it is copied
+        REQUIRE(structVector[3].isValid());
+        REQUIRE(var[3]("vector").toMatio() != fieldPointers[3]);
+        checkSameVector(var[3]("vector").asVector<double>(), structVector[3]("vector").asVector<double>());
+        REQUIRE(var[3]("name").asString()() == "content");
+
+        std::vector<matioCpp::Struct> differentFields;
+        differentFields.emplace_back(structVar);
+        differentFields.emplace_back(matioCpp::Struct("other", {matioCpp::Element<int>("element", 7),
+                                                                matioCpp::Element<int>("vector", 3),
+                                                                matioCpp::String("other", "content")}));
+        REQUIRE(differentFields[1].numberOfFields() == structVar.numberOfFields());
+        matioCpp::StructArray other("other");
+        REQUIRE_FALSE(other.fromVectorOfStructs({2,1}, differentFields));
+    }
+
     SECTION("Copy constructor")
     {
         std::vector<matioCpp::Variable> data;
@@ -235,6 +286,29 @@ TEST_CASE("Indeces from raw index")
 
 }
 
+TEST_CASE("Indices iteration")
+{
+    matioCpp::Struct element("element", {matioCpp::Element<size_t>("index")});
+    matioCpp::StructArray var("test", {2,3,2}, std::vector<matioCpp::Struct>(12, element));
+
+    for (const matioCpp::MultiIndex& index : var.indices())
+    {
+        var(index)("index").asElement<size_t>() = index.rawIndex();
+    }
+
+    for (const matioCpp::MultiIndex& index : var.indices())
+    {
+        REQUIRE(var[index]("index").asElement<size_t>() == index.rawIndex());
+        REQUIRE(var(index[0], index[1], index[2])("index").asElement<size_t>() == index.rawIndex());
+        REQUIRE(var.rawIndexFromIndices(std::array<size_t, 3>{{index[0], index[1], index[2]}}) == index.rawIndex());
+    }
+
+    REQUIRE(var(std::array<size_t, 3>{{1, 0, 1}})("index").asElement<size_t>() == 7);
+    const matioCpp::StructArray& constVar = var;
+    REQUIRE(constVar(1, 2, 1)("index").asElement<size_t>() == 11);
+    REQUIRE(constVar[std::array<size_t, 3>{{0, 2, 1}}]("index").asElement<size_t>() == 10);
+}
+
 TEST_CASE("Assignments and modifications")
 {
     std::vector<matioCpp::Variable> data;
@@ -388,6 +462,37 @@ TEST_CASE("Assignments and modifications")
 
         }
 
+        SECTION("Field handles")
+        {
+            matioCpp::FieldHandle element = in.getFieldHandle("element");
+            matioCpp::FieldHandle name = in.getFieldHandle("name");
+            REQUIRE(element.isValid());
+            REQUIRE(element.index() == 1);
+            REQUIRE(element.name() == "element");
+            REQUIRE(element.isValidFor(in));
+            REQUIRE_FALSE(element.isValidFor(out));
+            REQUIRE_FALSE(in.getFieldHandle("notExisting").isValid());
+            REQUIRE_FALSE(matioCpp::FieldHandle().isValid());
+
+            for (size_t i = 0; i < in.numberOfElements(); ++i)
+            {
+                REQUIRE(in(i).setField(element, matioCpp::Element<int>("other", static_cast<int>(i))));
+            }
+
+            const matioCpp::StructArray& constIn = in;
+            for (size_t i = 0; i < in.numberOfElements(); ++i)
+            {
+                REQUIRE(constIn(i)(element).asElement<int>() == static_cast<int>(i));
+                REQUIRE(in[i][name].asString()() == "content");
+            }
+
+            REQUIRE_FALSE(in(0).setField(in.getFieldHandle("notExisting"), matioCpp::Element<int>("other", 1)));
+
+            in.addField("addedField");
+            REQUIRE(element.isValidFor(in));
+            REQUIRE_FALSE(in.getFieldHandle("addedField").isValidFor(out));
+        }
+
         SECTION("Clear")
         {
             out.clear();
@@ -399,3 +504,135 @@ TEST_CASE("Assignments and modifications")
     Mat_VarFree(matioVar);
 }
 
+
+TEST_CASE("Growth")
+{
+    std::vector<matioCpp::Variable> data;
+    data.emplace_back(matioCpp::Element<int>("element", 1));
+    data.emplace_back(matioCpp::String("name", "content"));
+
+    matioCpp::Struct structVar("test", data);
+
+    SECTION("Push back")
+    {
+        matioCpp::StructArray array("array");
+        REQUIRE(array.numberOfElements() == 0);
+        REQUIRE(array.numberOfFields() == 0);
+
+        REQUIRE(array.push_back(structVar));
+        REQUIRE(structVar.isValid());
+        REQUIRE(array.numberOfFields() == 2);
+        REQUIRE(array.getFieldIndex("name") == 1);
+
+        matioCpp::Struct moved = structVar;
+        moved("element").asElement<int>() = 2;
+        const matvar_t* movedField = moved("name").toMatio();
+        REQUIRE(array.push_back(std::move(moved)));
+        REQUIRE_FALSE(moved.isValid());
+        REQUIRE(array(1)("name").toMatio() == movedField);
+
+        matioCpp::StructArrayElement<false> firstElement = array(0);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            matioCpp::Struct other = structVar;
+            other("element").asElement<int>() = i;
+            REQUIRE(array.push_back(std::move(other)));
+        }
+
+        REQUIRE(array.dimensions()(0) == 1);
+        REQUIRE(array.dimensions()(1) == 102);
+        REQUIRE(array(0)("element").asElement<int>() == 1);
+        REQUIRE(array(1)("element").asElement<int>() == 2);
+        REQUIRE(firstElement("name").asString()() == "content");
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(array(i + 2)("element").asElement<int>() == i);
+            REQUIRE(array(i + 2)("name").asString()() == "content");
+        }
+
+        matioCpp::Struct different("different");
+        REQUIRE(different.setField(matioCpp::Element<int>("element", 1)));
+        REQUIRE_FALSE(array.push_back(different));
+        REQUIRE_FALSE(array.push_back(std::move(different)));
+        REQUIRE(array.numberOfElements() == 102);
+
+        matioCpp::StructArray matrix("matrix", {2,2}, std::vector<matioCpp::Struct>(4, structVar));
+        REQUIRE_FALSE(matrix.push_back(structVar));
+        REQUIRE(matrix.numberOfElements() == 4);
+    }
+
+    SECTION("Append")
+    {
+        matioCpp::StructArray column("column", {2,1}, std::vector<matioCpp::Struct>(2, structVar));
+        std::vector<matioCpp::Struct> newElements(3, structVar);
+        newElements[2]("element").asElement<int>() = 3;
+
+        REQUIRE(column.append(newElements));
+        REQUIRE(newElements[0].isValid());
+        REQUIRE(column.dimensions()(0) == 5);
+        REQUIRE(column.dimensions()(1) == 1);
+        REQUIRE(column(4)("element").asElement<int>() == 3);
+
+        REQUIRE(column.append(std::move(newElements)));
+        REQUIRE(column.numberOfElements() == 8);
+        REQUIRE(column(7)("element").asElement<int>() == 3);
+
+        std::vector<matioCpp::Struct> wrong(2, structVar);
+        REQUIRE(wrong[1].setField(matioCpp::Element<int>("other", 1)));
+        REQUIRE_FALSE(column.append(wrong));
+        REQUIRE_FALSE(column.append(std::move(wrong)));
+        REQUIRE(column.numberOfElements() == 8);
+        REQUIRE(column.dimensions()(0) == 8);
+    }
+
+    SECTION("Resize")
+    {
+        std::vector<matioCpp::Struct> elements(4, structVar);
+        for (size_t i = 0; i < elements.size(); ++i)
+        {
+            elements[i]("element").asElement<int>() = static_cast<int>(i);
+        }
+        matioCpp::StructArray array("array", {2,2}, elements);
+        const matvar_t* pointer01 = array({0,1})("name").toMatio();
+
+        array.resize({3,3});
+        REQUIRE(array.numberOfElements() == 9);
+        REQUIRE(array.numberOfFields() == 2);
+        REQUIRE(array({0,0})("element").asElement<int>() == 0);
+        REQUIRE(array({1,0})("element").asElement<int>() == 1);
+        REQUIRE(array({0,1})("element").asElement<int>() == 2);
+        REQUIRE(array({1,1})("element").asElement<int>() == 3);
+        REQUIRE(array({0,1})("name").toMatio() == pointer01);
+
+        REQUIRE(array.setElement({2,2}, structVar));
+        REQUIRE(array({2,2})("element").asElement<int>() == 1);
+
+        array.resize({1,2});
+        REQUIRE(array.numberOfElements() == 2);
+        REQUIRE(array(1)("element").asElement<int>() == 2);
+    }
+
+    SECTION("Write")
+    {
+        matioCpp::StructArray array("array");
+        for (int i = 0; i < 10; ++i)
+        {
+            matioCpp::Struct other = structVar;
+            other("element").asElement<int>() = i;
+            REQUIRE(array.push_back(std::move(other)));
+        }
+
+        matioCpp::File file = matioCpp::File::Create("testStructArrayGrowth.mat");
+        REQUIRE(file.isOpen());
+        REQUIRE(file.write(array));
+
+        matioCpp::StructArray read = file.read("array").asStructArray();
+        REQUIRE(read.isValid());
+        REQUIRE(read.numberOfElements() == 10);
+        for (int i = 0; i < 10; ++i)
+        {
+            REQUIRE(read(i)("element").asElement<int>() == i);
+        }
+    }
+}
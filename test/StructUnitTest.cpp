@@ -334,3 +334,175 @@ TEST_CASE("Modifications")
     in.clear();
     REQUIRE(in.numberOfFields() == 0);
 }
+
+TEST_CASE("Cached data of fields")
+{
+    std::vector<matioCpp::Variable> data;
+    data.emplace_back(matioCpp::Vector<double>("vector", 4));
+    data.emplace_back(matioCpp::Element<int>("element"));
+
+    matioCpp::Struct in("test", data);
+
+    matioCpp::Vector<double> vector = in("vector").asVector<double>();
+    matioCpp::Element<int> element = in("element").asElement<int>();
+    for (size_t i = 0; i < vector.size(); ++i)
+    {
+        vector(i) = static_cast<double>(i);
+    }
+    element = 3;
+
+    REQUIRE(in("vector").asVector<double>()(3) == 3.0);
+    REQUIRE(in("element").asElement<int>()() == 3);
+
+    const double* cachedPointer = vector.data();
+    REQUIRE(vector.data() == cachedPointer);
+    REQUIRE(vector(2) == 2.0);
+
+    REQUIRE(in.setField(matioCpp::Vector<double>("vector", 2)));
+    REQUIRE_FALSE(vector.isValid());
+    REQUIRE(vector.data() == nullptr);
+    REQUIRE(element.isValid());
+    REQUIRE(element() == 3);
+
+    matioCpp::Vector<double> newVector = in("vector").asVector<double>();
+    REQUIRE(newVector.size() == 2);
+    newVector(1) = 5.0;
+    REQUIRE(in("vector").asVector<double>()(1) == 5.0);
+
+    matioCpp::Struct other("other", data);
+    REQUIRE(other.setField(matioCpp::Vector<double>("vector", 3)));
+    REQUIRE(newVector(1) == 5.0);
+
+    in.clear();
+    REQUIRE_FALSE(element.isValid());
+    REQUIRE_FALSE(newVector.isValid());
+
+    matioCpp::Vector<double> otherVector = other("vector").asVector<double>();
+    REQUIRE(otherVector.size() == 3);
+    other = matioCpp::Struct("other");
+    REQUIRE_FALSE(otherVector.isValid());
+    REQUIRE(otherVector.data() == nullptr);
+}
+
+TEST_CASE("Many fields")
+{
+    std::vector<matioCpp::Variable> fields;
+    for (int i = 0; i < 100; ++i)
+    {
+        fields.emplace_back(matioCpp::Element<int>("field" + std::to_string(i), i));
+    }
+
+    matioCpp::Struct in("test", fields);
+
+    for (int i = 99; i >= 0; --i)
+    {
+        std::string name = "field" + std::to_string(i);
+        REQUIRE(in.isFieldExisting(name));
+        REQUIRE(in.getFieldIndex(name) == static_cast<size_t>(i));
+        REQUIRE(in(name).asElement<int>()() == i);
+    }
+    REQUIRE_FALSE(in.isFieldExisting("notExisting"));
+    REQUIRE(in.getFieldIndex("notExisting") == 100);
+
+    REQUIRE(in.setField("newField", matioCpp::Element<int>("newField", 100)));
+    REQUIRE(in.numberOfFields() == 101);
+    REQUIRE(in.getFieldIndex("newField") == 100);
+    REQUIRE(in("newField").asElement<int>()() == 100);
+    REQUIRE(in("field50").asElement<int>()() == 50);
+
+    std::vector<matioCpp::Variable> reversedFields(fields.rbegin(), fields.rend());
+    matioCpp::Struct outer("outer", {in});
+    matioCpp::Struct nested = outer("test").asStruct();
+    REQUIRE(nested.getFieldIndex("field10") == 10);
+
+    REQUIRE(outer.setField(matioCpp::Struct("test", reversedFields))); //The index of the previous struct is discarded
+    matioCpp::Struct newNested = outer("test").asStruct();
+    REQUIRE(newNested.getFieldIndex("field10") == 89);
+    REQUIRE(newNested("field10").asElement<int>()() == 10);
+    REQUIRE_FALSE(newNested.isFieldExisting("newField"));
+
+    matioCpp::Struct copy(in);
+    REQUIRE(copy.getFieldIndex("newField") == 100);
+}
+
+TEST_CASE("Moving fields")
+{
+    std::vector<matioCpp::Variable> data;
+    data.emplace_back(matioCpp::Vector<double>("vector", 4));
+    data.emplace_back(matioCpp::Element<int>("element", 3));
+    const matvar_t* elementPointer = data[1].toMatio();
+
+    matioCpp::Struct in("test", std::move(data));
+    REQUIRE(in.numberOfFields() == 2);
+    REQUIRE_FALSE(data[1].isValid());
+    REQUIRE(in("element").toMatio() == elementPointer);
+    REQUIRE(in("element").asElement<int>()() == 3);
+
+    matioCpp::Vector<double> vector("vector", 3);
+    const matvar_t* vectorPointer = vector.toMatio();
+    matioCpp::Variable previousVector = in("vector");
+    REQUIRE(in.setField(std::move(vector)));
+    REQUIRE_FALSE(vector.isValid());
+    REQUIRE_FALSE(previousVector.isValid());
+    REQUIRE(in("vector").toMatio() == vectorPointer);
+    REQUIRE(in("vector").asVector<double>().size() == 3);
+
+    matioCpp::SharedMatvar sharedMatvar(matioCpp::MatvarHandler::GetMatvarDuplicate(matioCpp::Element<int>("shared", 5).toMatio()));
+    matioCpp::Element<int> sharedElement(sharedMatvar);
+    REQUIRE(in.setField("element", std::move(sharedElement)));
+    REQUIRE(sharedElement.isValid());
+    REQUIRE(in("element").toMatio() != sharedElement.toMatio());
+    REQUIRE(in("element").asElement<int>()() == 5);
+
+    std::vector<matioCpp::Variable> newFields;
+    newFields.emplace_back(matioCpp::String("name", "content"));
+    newFields.emplace_back(matioCpp::Element<int>("element", 10));
+    newFields.emplace_back(matioCpp::Vector<double>("other", 2));
+    std::vector<const matvar_t*> newPointers;
+    for (const matioCpp::Variable& field : newFields)
+    {
+        newPointers.push_back(field.toMatio());
+    }
+    matioCpp::Variable keptVector = in("vector");
+
+    REQUIRE(in.setFields(std::move(newFields)));
+    REQUIRE_FALSE(keptVector.isValid());
+    REQUIRE(in.fields() == std::vector<std::string>({"vector", "element", "name", "other"}));
+    REQUIRE(in("vector").toMatio() == vectorPointer);
+    REQUIRE(in("element").toMatio() == newPointers[1]);
+    REQUIRE(in("name").toMatio() == newPointers[0]);
+    REQUIRE(in("other").toMatio() == newPointers[2]);
+    REQUIRE(in("element").asElement<int>()() == 10);
+    REQUIRE(in("name").asString()() == "content");
+    for (const matioCpp::Variable& field : newFields)
+    {
+        REQUIRE_FALSE(field.isValid());
+    }
+
+    std::vector<matioCpp::Variable> repeatedFields;
+    repeatedFields.emplace_back(matioCpp::Element<int>("element", 1));
+    repeatedFields.emplace_back(matioCpp::Element<int>("element", 2));
+    REQUIRE_FALSE(in.setFields(std::move(repeatedFields)));
+    REQUIRE(repeatedFields[0].isValid());
+    REQUIRE(in("element").asElement<int>()() == 10);
+
+    std::vector<matioCpp::Variable> moreFields;
+    moreFields.emplace_back(in("name"));
+    moreFields.emplace_back(matioCpp::Element<int>("last", 4));
+    matioCpp::Struct outer("outer", {in});
+    matioCpp::Struct nested = outer("test").asStruct();
+    REQUIRE_FALSE(nested.setFields(std::move(moreFields)));
+    REQUIRE(moreFields[1].isValid());
+
+    //The ownership of the struct is shared, hence the fields that are not set are copied
+    matioCpp::SharedMatvar sharedStructMatvar(matioCpp::MatvarHandler::GetMatvarDuplicate(in.toMatio()));
+    matioCpp::Struct sharedStruct(sharedStructMatvar);
+    REQUIRE(sharedStruct.setFields(std::move(moreFields)));
+    REQUIRE_FALSE(moreFields[1].isValid());
+    REQUIRE(sharedStruct.numberOfFields() == 5);
+    REQUIRE(sharedStruct("name").asString()() == "content");
+    REQUIRE(sharedStruct("last").asElement<int>()() == 4);
+    REQUIRE(sharedStruct("element").asElement<int>()() == 10);
+    REQUIRE(matioCpp::Struct(sharedStructMatvar)("last").asElement<int>()() == 4);
+    REQUIRE(in("name").asString()() == "content");
+}
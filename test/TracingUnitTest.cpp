@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024 Fondazione Istituto Italiano di Tecnologia
+ *
+ * This software may be modified and distributed under the terms of the
+ * BSD-2-Clause license (https://opensource.org/licenses/BSD-2-Clause).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <matioCpp/matioCpp.h>
+#include <sstream>
+#include <thread>
+
+TEST_CASE("Disabled tracing")
+{
+    if (matioCpp::Tracing::isEnabled())
+    {
+        return;
+    }
+
+    REQUIRE_FALSE(matioCpp::Tracing::start());
+    REQUIRE_FALSE(matioCpp::Tracing::isRecording());
+    REQUIRE(matioCpp::Tracing::droppedEvents() == 0);
+
+    std::stringstream output;
+    matioCpp::Tracing::writeChromeTrace(output);
+    REQUIRE(output.str() == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n");
+}
+
+TEST_CASE("Trace events")
+{
+    if (!matioCpp::Tracing::isEnabled())
+    {
+        return;
+    }
+
+    REQUIRE(matioCpp::Tracing::start());
+    REQUIRE(matioCpp::Tracing::isRecording());
+
+    std::vector<matioCpp::Variable> fields;
+    fields.emplace_back(matioCpp::Vector<double>("tracedVector", std::vector<double>(10, 1.0)));
+    fields.emplace_back(matioCpp::String("tracedText", "text"));
+    matioCpp::Struct structure("tracedStruct", fields);
+    REQUIRE(structure("tracedText").isValid());
+
+    matioCpp::File::Delete("testTracing.mat");
+    matioCpp::File file = matioCpp::File::Create("testTracing.mat", matioCpp::FileVersion::MAT5);
+    REQUIRE(file.write(structure, matioCpp::Compression::zlib));
+    file.close();
+    REQUIRE(file.open("testTracing.mat"));
+    REQUIRE(file.read("tracedStruct").isValid());
+
+    std::thread other([]()
+    {
+        matioCpp::Tracing::ScopedEvent event("Other thread");
+        event.setDetails("custom \"detail\"", 10);
+    });
+    other.join();
+
+    matioCpp::Tracing::stop();
+    REQUIRE_FALSE(matioCpp::Tracing::isRecording());
+
+    REQUIRE(file.read("tracedStruct").isValid()); // Not recorded
+
+    std::stringstream output;
+    matioCpp::Tracing::writeChromeTrace(output);
+    std::string trace = output.str();
+
+    REQUIRE(trace.find("\"traceEvents\":[") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"VariableInitialization\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"FileWriteCompressed\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"FileRead\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"Struct field access\"") != std::string::npos);
+    REQUIRE(trace.find("\"detail\":\"tracedText\"") != std::string::npos);
+    REQUIRE(trace.find("\"detail\":\"tracedStruct\"") != std::string::npos);
+    REQUIRE(trace.find("\"detail\":\"custom \\\"detail\\\"\",\"bytes\":10") != std::string::npos);
+    REQUIRE(trace.find("\"tid\":2") != std::string::npos);
+
+    size_t reads = 0;
+    for (size_t position = trace.find("\"name\":\"FileRead\""); position != std::string::npos;
+         position = trace.find("\"name\":\"FileRead\"", position + 1))
+    {
+        reads++;
+    }
+    REQUIRE(reads == 1);
+    REQUIRE(matioCpp::Tracing::droppedEvents() == 0);
+}
+
+TEST_CASE("Dropped events")
+{
+    if (!matioCpp::Tracing::isEnabled())
+    {
+        return;
+    }
+
+    REQUIRE(matioCpp::Tracing::start(2));
+    for (size_t i = 0; i < 5; ++i)
+    {
+        matioCpp::Tracing::ScopedEvent event("Event");
+    }
+    matioCpp::Tracing::stop();
+    REQUIRE(matioCpp::Tracing::droppedEvents() == 3);
+
+    REQUIRE(matioCpp::Tracing::start());
+    matioCpp::Tracing::stop();
+    REQUIRE(matioCpp::Tracing::droppedEvents() == 0);
+
+    std::stringstream output;
+    matioCpp::Tracing::writeChromeTrace(output);
+    REQUIRE(output.str().find("\"name\":\"Event\"") == std::string::npos);
+}
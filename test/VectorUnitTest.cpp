@@ -112,6 +112,53 @@ TEST_CASE("Constructors")
         REQUIRE(var.valueType() == matioCpp::ValueType::INT64);
     }
 
+    SECTION("Name and borrowed Span")
+    {
+        std::vector<double> vec = {1.0, 2.0, 3.0};
+        matioCpp::Vector<double> var("test", matioCpp::make_span(vec), matioCpp::DataOwnership::Borrow);
+
+        REQUIRE(var.variableType() == matioCpp::VariableType::Vector);
+        REQUIRE(var.valueType() == matioCpp::ValueType::DOUBLE);
+        REQUIRE(var.size() == vec.size());
+        REQUIRE(var.data() == vec.data());
+
+        var(1) = 5.0;
+        REQUIRE(vec[1] == 5.0);
+
+        matioCpp::Vector<double> copy(var);
+        REQUIRE(copy.data() != vec.data());
+        checkSameVector(copy, var);
+
+        var.resize(5);
+        REQUIRE(var.data() != vec.data());
+        REQUIRE(var(1) == 5.0);
+        REQUIRE(vec[1] == 5.0);
+    }
+
+    SECTION("Name and moved vector")
+    {
+        std::vector<int64_t> vec = {1, 2, 3, 4};
+        const int64_t* vecData = vec.data();
+        matioCpp::Vector<int64_t> shared;
+        {
+            matioCpp::Vector<int64_t> var("test", std::move(vec));
+
+            REQUIRE(var.variableType() == matioCpp::VariableType::Vector);
+            REQUIRE(var.valueType() == matioCpp::ValueType::INT64);
+            REQUIRE(var.size() == 4);
+            REQUIRE(var.data() == vecData);
+            REQUIRE(var(3) == 4);
+
+            shared = var.asVector<int64_t>();
+        }
+        REQUIRE(shared.data() == vecData);
+        REQUIRE(shared(3) == 4);
+
+        matioCpp::Vector<double> empty("empty", std::vector<double>());
+        REQUIRE(empty.isValid());
+        REQUIRE(empty.size() == 0);
+    }
+
     SECTION("Name and vector of bool")
     {
         std::vector<bool> test = {true, false, true};
@@ -351,6 +398,129 @@ TEST_CASE("Modifications")
     REQUIRE(in.size() == 0);
 }
 
+TEST_CASE("Growth")
+{
+    SECTION("push_back")
+    {
+        matioCpp::Vector<double> vector("test");
+        size_t reallocations = 0;
+        const double* previousData = vector.data();
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            REQUIRE(vector.push_back(static_cast<double>(i)));
+            if (vector.data() != previousData)
+            {
+                reallocations++;
+                previousData = vector.data();
+            }
+        }
+
+        REQUIRE(reallocations < 20);
+        REQUIRE(vector.size() == 1000);
+        REQUIRE(vector.capacity() >= 1000);
+        checkVariable(vector, "test", matioCpp::VariableType::Vector, matioCpp::ValueType::DOUBLE, false, {1, 1000});
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            REQUIRE(vector(i) == static_cast<double>(i));
+        }
+
+        REQUIRE(vector.push_back(vector(999)));
+        REQUIRE(vector(1000) == 999.0);
+
+        matioCpp::Vector<double> copy(vector);
+        checkSameVector(copy, vector);
+    }
+
+    SECTION("reserve")
+    {
+        matioCpp::Vector<int> vector("test", 3);
+        vector(2) = 7;
+        REQUIRE(vector.reserve(100));
+        REQUIRE(vector.capacity() == 100);
+        REQUIRE(vector.size() == 3);
+        REQUIRE(vector(2) == 7);
+        REQUIRE(vector.reserve(10));
+        REQUIRE(vector.capacity() == 100);
+
+        const int* reservedData = vector.data();
+        for (int i = 0; i < 97; ++i)
+        {
+            REQUIRE(vector.push_back(i));
+        }
+        REQUIRE(vector.data() == reservedData);
+        REQUIRE(vector.size() == 100);
+
+        vector.resize(10);
+        REQUIRE(vector.size() == 10);
+        REQUIRE(vector.capacity() == 100);
+        vector.resize(12);
+        REQUIRE(vector(10) == 0);
+        REQUIRE(vector(11) == 0);
+    }
+
+    SECTION("append")
+    {
+        std::vector<double> column = {1.0, 2.0, 3.0};
+        std::vector<size_t> dimensions = {column.size(), 1};
+        matvar_t* matioVar = Mat_VarCreate("column", matio_classes::MAT_C_DOUBLE, matio_types::MAT_T_DOUBLE, static_cast<int>(dimensions.size()), dimensions.data(), column.data(), 0);
+        REQUIRE(matioVar);
+        matioCpp::Vector<double> vector((matioCpp::SharedMatvar(matioVar)));
+
+        std::vector<double> tail = {4.0, 5.0};
+        REQUIRE(vector.append(matioCpp::make_span(tail)));
+        REQUIRE(vector.append(vector.toSpan()));
+        REQUIRE(vector.append(matioCpp::Span<const double>()));
+
+        std::vector<double> expected = {1.0, 2.0, 3.0, 4.0, 5.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+        checkVariable(vector, "column", matioCpp::VariableType::Vector, matioCpp::ValueType::DOUBLE, false, {10, 1});
+        checkSameVector(matioCpp::make_span(expected), vector.toSpan());
+    }
+
+    SECTION("Borrowed data")
+    {
+        std::vector<double> vec = {1.0, 2.0, 3.0};
+        matioCpp::Vector<double> vector("test", matioCpp::make_span(vec), matioCpp::DataOwnership::Borrow);
+        REQUIRE(vector.capacity() == 3);
+
+        REQUIRE(vector.push_back(4.0));
+        REQUIRE(vector.data() != vec.data());
+        REQUIRE(vec.size() == 3);
+        REQUIRE(vector.size() == 4);
+        REQUIRE(vector(0) == 1.0);
+        REQUIRE(vector(3) == 4.0);
+    }
+
+    SECTION("View")
+    {
+        matioCpp::Struct structure("structure", {matioCpp::Vector<double>("field", 3)});
+        matioCpp::Vector<double> field = structure("field").asVector<double>();
+
+        REQUIRE_FALSE(field.push_back(1.0));
+        std::vector<double> values = {1.0, 2.0};
+        REQUIRE_FALSE(field.append(matioCpp::make_span(values)));
+        REQUIRE_FALSE(field.reserve(10));
+        REQUIRE(structure("field").asVector<double>().size() == 3);
+    }
+
+    SECTION("Write")
+    {
+        matioCpp::Vector<double> vector("vector");
+        for (size_t i = 0; i < 100; ++i)
+        {
+            REQUIRE(vector.push_back(0.5 * i));
+        }
+        REQUIRE(vector.capacity() > vector.size());
+
+        matioCpp::File file = matioCpp::File::Create("testVectorGrowth.mat");
+        REQUIRE(file.write(vector));
+        matioCpp::Vector<double> read = file.read("vector").asVector<double>();
+        REQUIRE(read.isValid());
+        checkSameVector(read, vector);
+        file.close();
+        REQUIRE(matioCpp::File::Delete("testVectorGrowth.mat"));
+    }
+}
+
 TEST_CASE("Data")
 {
     std::vector<int> in = {2,4,6,8};